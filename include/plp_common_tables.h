@@ -67,9 +67,253 @@ extern const uint16_t plpBitRevIndexTable_fixed_1024[PLPBITREVINDEXTABLE_FIXED_1
 extern const uint16_t plpBitRevIndexTable_fixed_2048[PLPBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH];
 extern const uint16_t plpBitRevIndexTable_fixed_4096[PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
 
-extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
-extern const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1];
-extern const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1];
+extern const float32_t sinTable_f32[FAST_MATH_SIN_TABLE_LENGTH];
+extern const int32_t sinTable_q32[FAST_MATH_SIN_TABLE_LENGTH];
+extern const int16_t sinTable_q16[FAST_MATH_SIN_TABLE_LENGTH];
+
+/*
+ * Entry k in [0, FAST_MATH_TABLE_SIZE] of the full period sine tables. With a quarter wave table
+ * the entry is mirrored and negated from [0, PI/2], otherwise it is a plain table read.
+ */
+#if defined(PLP_FAST_MATH_QUARTER_WAVE)
+
+#define PLP_SIN_TABLE_FOLD(k)                                                                      \
+    ((((k) >> (PLP_FAST_MATH_TABLE_BITS - 2)) & 1)                                                 \
+         ? FAST_MATH_TABLE_SIZE / 4 - ((k) & (FAST_MATH_TABLE_SIZE / 4 - 1))                       \
+         : ((k) & (FAST_MATH_TABLE_SIZE / 4 - 1)))
+#define PLP_SIN_TABLE_NEG(k) (((k) >> (PLP_FAST_MATH_TABLE_BITS - 1)) & 1)
+
+static inline float32_t plp_sin_table_f32(uint32_t k) {
+    float32_t v = sinTable_f32[PLP_SIN_TABLE_FOLD(k)];
+    return PLP_SIN_TABLE_NEG(k) ? -v : v;
+}
+
+static inline int32_t plp_sin_table_q32(uint32_t k) {
+    int32_t v = sinTable_q32[PLP_SIN_TABLE_FOLD(k)];
+    return PLP_SIN_TABLE_NEG(k) ? -v : v;
+}
+
+static inline int16_t plp_sin_table_q16(uint32_t k) {
+    int16_t v = sinTable_q16[PLP_SIN_TABLE_FOLD(k)];
+    return PLP_SIN_TABLE_NEG(k) ? -v : v;
+}
+
+/* entries k and k + 1 of the q16 table as a vector */
+static inline v2s plp_sin_table_pair_q16(uint32_t k) {
+    return (v2s){ plp_sin_table_q16(k), plp_sin_table_q16(k + 1) };
+}
+
+#else
+
+static inline float32_t plp_sin_table_f32(uint32_t k) { return sinTable_f32[k]; }
+
+static inline int32_t plp_sin_table_q32(uint32_t k) { return sinTable_q32[k]; }
+
+static inline int16_t plp_sin_table_q16(uint32_t k) { return sinTable_q16[k]; }
+
+/* entries k and k + 1 of the q16 table as a vector */
+static inline v2s plp_sin_table_pair_q16(uint32_t k) { return *((v2s *)(sinTable_q16 + k)); }
+
+#endif
+
+/* linear interpolation between the entries k and k + 1, fract in Q1.31 */
+static inline int32_t plp_sin_interp_q32(uint32_t k, int32_t fract) {
+    int32_t a = plp_sin_table_q32(k);
+    return (((int64_t)a << 31) + (int64_t)(plp_sin_table_q32(k + 1) - a) * fract) >> 31;
+}
+
+/* linear interpolation between the entries k and k + 1, w1 in Q2.14 */
+static inline int16_t plp_sin_interp_q16(uint32_t k, int32_t w1) {
+    return (plp_sin_table_q16(k) * (0x4000 - w1) + plp_sin_table_q16(k + 1) * w1) >> 14;
+}
+
+/* linear interpolation between the entries k and k + 1, fract in [0, 1) */
+static inline float32_t plp_sin_interp_f32(uint32_t k, float32_t fract) {
+    return (1.0f - fract) * plp_sin_table_f32(k) + fract * plp_sin_table_f32(k + 1);
+}
+
+/*
+ * Cosine and sine of a 32-bit phase for the numerically controlled oscillators, a full turn is
+ * 2^32. The phase within the quadrant and its mirror image, which gives the cosine, are
+ * interpolated from the first quarter of the sine table, the two most significant bits of the
+ * phase select the quadrant.
+ */
+static inline void plp_nco_lookup_q32(uint32_t phase, int32_t *pCos, int32_t *pSin) {
+    uint32_t u = phase & 0x3FFFFFFFU;
+    uint32_t index;
+    int32_t fract, s, c;
+
+    // sine of the phase within the quadrant and of its mirror image, which is the cosine
+    index = u >> PLP_NCO_QUARTER_SHIFT;
+    fract = u & ((1U << PLP_NCO_QUARTER_SHIFT) - 1);
+    s = (((int64_t)sinTable_q32[index] << PLP_NCO_QUARTER_SHIFT)
+         + (int64_t)(sinTable_q32[index + 1] - sinTable_q32[index]) * fract)
+        >> PLP_NCO_QUARTER_SHIFT;
+    u = 0x40000000U - u;
+    index = u >> PLP_NCO_QUARTER_SHIFT;
+    fract = u & ((1U << PLP_NCO_QUARTER_SHIFT) - 1);
+    c = (((int64_t)sinTable_q32[index] << PLP_NCO_QUARTER_SHIFT)
+         + (int64_t)(sinTable_q32[index + 1] - sinTable_q32[index]) * fract)
+        >> PLP_NCO_QUARTER_SHIFT;
+
+    switch (phase >> 30) {
+    case 0:
+        *pSin = s;
+        *pCos = c;
+        break;
+    case 1:
+        *pSin = c;
+        *pCos = -s;
+        break;
+    case 2:
+        *pSin = -s;
+        *pCos = -c;
+        break;
+    default:
+        *pSin = -c;
+        *pCos = s;
+        break;
+    }
+}
+
+static inline void plp_nco_lookup_q16(uint32_t phase, int16_t *pCos, int16_t *pSin) {
+    uint32_t u = phase & 0x3FFFFFFFU;
+    uint32_t index;
+    int32_t w1, s, c;
+
+    // sine of the phase within the quadrant and of its mirror image, which is the cosine
+    index = u >> PLP_NCO_QUARTER_SHIFT;
+    w1 = (u >> (PLP_NCO_QUARTER_SHIFT - 14)) & 0x3FFF;
+    s = ((int32_t)sinTable_q16[index] * (0x4000 - w1) + sinTable_q16[index + 1] * w1) >> 14;
+    u = 0x40000000U - u;
+    index = u >> PLP_NCO_QUARTER_SHIFT;
+    w1 = (u >> (PLP_NCO_QUARTER_SHIFT - 14)) & 0x3FFF;
+    c = ((int32_t)sinTable_q16[index] * (0x4000 - w1) + sinTable_q16[index + 1] * w1) >> 14;
+
+    switch (phase >> 30) {
+    case 0:
+        *pSin = s;
+        *pCos = c;
+        break;
+    case 1:
+        *pSin = c;
+        *pCos = -s;
+        break;
+    case 2:
+        *pSin = -s;
+        *pCos = -c;
+        break;
+    default:
+        *pSin = -c;
+        *pCos = s;
+        break;
+    }
+}
+
+static inline void plp_nco_lookup_f32(uint32_t phase, float32_t *pCos, float32_t *pSin) {
+    const float32_t scale = 1.0f / (float32_t)(1U << PLP_NCO_QUARTER_SHIFT);
+    uint32_t u = phase & 0x3FFFFFFFU;
+    uint32_t index;
+    float32_t fract, s, c;
+
+    // sine of the phase within the quadrant and of its mirror image, which is the cosine
+    index = u >> PLP_NCO_QUARTER_SHIFT;
+    fract = (float32_t)(u & ((1U << PLP_NCO_QUARTER_SHIFT) - 1)) * scale;
+    s = sinTable_f32[index] + fract * (sinTable_f32[index + 1] - sinTable_f32[index]);
+    u = 0x40000000U - u;
+    index = u >> PLP_NCO_QUARTER_SHIFT;
+    fract = (float32_t)(u & ((1U << PLP_NCO_QUARTER_SHIFT) - 1)) * scale;
+    c = sinTable_f32[index] + fract * (sinTable_f32[index + 1] - sinTable_f32[index]);
+
+    switch (phase >> 30) {
+    case 0:
+        *pSin = s;
+        *pCos = c;
+        break;
+    case 1:
+        *pSin = c;
+        *pCos = -s;
+        break;
+    case 2:
+        *pSin = -s;
+        *pCos = -c;
+        break;
+    default:
+        *pSin = -c;
+        *pCos = s;
+        break;
+    }
+}
+
+/* rounds a Q2.62 product of a sample and the oscillator to Q1.31 and saturates it, since the
+   interpolated oscillator can exceed 1 by a fraction of an LSB */
+static inline int32_t plp_nco_round_sat_q32(int64_t x) {
+    x = (x + 0x40000000) >> 31;
+    return x > 0x7FFFFFFF ? 0x7FFFFFFF : (x < -0x7FFFFFFF - 1 ? -0x7FFFFFFF - 1 : x);
+}
+
+extern const uint16_t rsqrtTable_q16[RSQRT_TABLE_SIZE];
+
+/*
+ * 1 / sqrt(m) in Q2.30 of a mantissa m in [0.25, 1) given in Q0.32, i.e. in [2^30, 2^32). Two
+ * Newton steps from the table seed on the upper 31 bits of m leave a relative error of about
+ * 2^-21. The last step is taken on the residual 1 - m * r^2 in Q1.63 with all bits of m and
+ * rounded, so the result is within half an LSB.
+ */
+static inline uint32_t plp_rsqrt_mant_q32(uint32_t m) {
+    uint32_t m31 = m >> 1;
+    uint32_t r = (uint32_t)rsqrtTable_q16[(m31 >> 25) - 16] << 15;
+    uint32_t t;
+    uint64_t r2, mr2;
+    int64_t e;
+
+    // r = r * (3 - m * r^2) / 2 with r^2 and m * r^2 in Q3.29
+    t = ((uint64_t)r * r) >> 31;
+    t = ((uint64_t)m31 * t) >> 31;
+    r = ((uint64_t)r * ((3U << 29) - t)) >> 30;
+
+    t = ((uint64_t)r * r) >> 31;
+    t = ((uint64_t)m31 * t) >> 31;
+    r = ((uint64_t)r * ((3U << 29) - t)) >> 30;
+
+    // r = r + r * e / 2 with e = 1 - m * r^2, m * r^2 in Q1.63 from the two halves of r^2 in Q4.60
+    r2 = (uint64_t)r * r;
+    mr2 = (((uint64_t)m * (uint32_t)(r2 >> 32)) << 3) + (((uint64_t)m * (uint32_t)r2) >> 29);
+    e = (int64_t)((1ULL << 63) - mr2);
+    r += (int32_t)(((int64_t)r * (e >> 16) + (1LL << 47)) >> 48);
+
+    return r;
+}
+
+extern const int32_t exp2Table_q32[FAST_MATH_EXP_TABLE_SIZE];
+extern const float32_t exp2Table_f32[FAST_MATH_EXP_TABLE_SIZE];
+extern const int32_t logTable_q32[FAST_MATH_LOG_TABLE_SIZE];
+extern const float32_t logTable_f32[FAST_MATH_LOG_TABLE_SIZE];
+extern const int32_t recipTable_q32[FAST_MATH_LOG_TABLE_SIZE];
+extern const float32_t recipTable_f32[FAST_MATH_LOG_TABLE_SIZE];
+extern const int32_t log2Table_q32[FAST_MATH_LOG2_TABLE_SIZE + 1];
+extern const float32_t log2Table_f32[FAST_MATH_LOG2_TABLE_SIZE + 1];
+extern const int32_t atanTable_q32[FAST_MATH_ATAN_TABLE_SIZE + 1];
+extern const float32_t atanTable_f32[FAST_MATH_ATAN_TABLE_SIZE + 1];
+extern const int32_t tanhTable_q32[FAST_MATH_TANH_TABLE_SIZE + 1];
+extern const float32_t tanhTable_f32[FAST_MATH_TANH_TABLE_SIZE + 1];
+
+/* log2(m) in Q2.30 of a mantissa m in [1, 2) given in UQ1.31, interpolated linearly */
+static inline int32_t plp_log2_interp_q32(uint32_t m) {
+    uint32_t k = (m >> (31 - FAST_MATH_LOG2_TABLE_BITS)) & (FAST_MATH_LOG2_TABLE_SIZE - 1);
+    uint32_t fract = (m << FAST_MATH_LOG2_TABLE_BITS) & 0x7FFFFFFFU;
+    int32_t a = log2Table_q32[k];
+    return a + (int32_t)(((int64_t)(log2Table_q32[k + 1] - a) * fract) >> 31);
+}
+
+/* log2(1 + k / FAST_MATH_LOG2_TABLE_SIZE) interpolated towards entry k + 1, fract in [0, 1) */
+static inline float32_t plp_log2_interp_f32(uint32_t k, float32_t fract) {
+    return log2Table_f32[k] + fract * (log2Table_f32[k + 1] - log2Table_f32[k]);
+}
+
+extern const int16_t magFastCoef_q16[PLP_CMPLX_MAG_FAST_COEF_LENGTH];
+extern const int32_t magFastCoef_q32[PLP_CMPLX_MAG_FAST_COEF_LENGTH];
+extern const float32_t magFastCoef_f32[PLP_CMPLX_MAG_FAST_COEF_LENGTH];
 
 extern const Complex_type_f32 twiddleCoef_rfft_2048[1024];
 
@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_abs_f32s_xpulpv2.c
+ * Description:  32-bit float vector absolute value kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAbs
+ */
+
+/**
+  @addtogroup BasicAbsKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element absolute value of 32-bit float vectors kernel for XPULPV2 extension.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_abs_f32s_xpulpv2(const float32_t *pSrc,
+                          float32_t *pDst,
+                          uint32_t blockSize) {
+    uint32_t blkCnt; /* Loop counter */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    float32_t a0, a1, a2, a3;
+
+    /* Loop unrolling: Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U) {
+        /* load all operands first, so that the FPU latency is hidden behind the loads */
+        a0 = pSrc[0];
+        a1 = pSrc[1];
+        a2 = pSrc[2];
+        a3 = pSrc[3];
+
+        /* C = |A| */
+        pDst[0] = __builtin_fabsf(a0);
+        pDst[1] = __builtin_fabsf(a1);
+        pDst[2] = __builtin_fabsf(a2);
+        pDst[3] = __builtin_fabsf(a3);
+
+        pSrc += 4;
+        pDst += 4;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        /* C = |A| */
+        *pDst++ = __builtin_fabsf(*pSrc++);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicAbsKernels group
+ */
@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_f32s_xpulpv2.c
+ * Description:  32-bit float vector addition kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAdd
+ */
+
+/**
+  @addtogroup BasicAddKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element addition of 32-bit float vectors kernel for XPULPV2 extension.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_add_f32s_xpulpv2(const float32_t *pSrcA,
+                          const float32_t *pSrcB,
+                          float32_t *pDst,
+                          uint32_t blockSize) {
+    uint32_t blkCnt; /* Loop counter */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    float32_t a0, a1, a2, a3;
+    float32_t b0, b1, b2, b3;
+
+    /* Loop unrolling: Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U) {
+        /* load all operands first, so that the FPU latency is hidden behind the loads */
+        a0 = pSrcA[0];
+        a1 = pSrcA[1];
+        a2 = pSrcA[2];
+        a3 = pSrcA[3];
+        b0 = pSrcB[0];
+        b1 = pSrcB[1];
+        b2 = pSrcB[2];
+        b3 = pSrcB[3];
+
+        /* C = A + B */
+        pDst[0] = a0 + b0;
+        pDst[1] = a1 + b1;
+        pDst[2] = a2 + b2;
+        pDst[3] = a3 + b3;
+
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        /* C = A + B */
+        *pDst++ = (*pSrcA++) + (*pSrcB++);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicAddKernels group
+ */
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_sat_i16s_rv32im.c
+ * Description:  16-bit integer vector saturating addition kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAddSat
+ */
+
+/**
+  @defgroup BasicAddSatKernels Saturating Vector Addition Kernels
+  This module contains the kernels for saturating addition of 8- and 16-bit vectors.
+ */
+
+/**
+  @addtogroup BasicAddSatKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element saturating addition of 16-bit integer vectors kernel for RV32IM
+  extension.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_add_sat_i16s_rv32im(const int16_t *pSrcA,
+                             const int16_t *pSrcB,
+                             int16_t *pDst,
+                             uint32_t blockSize) {
+    uint32_t blkCnt; /* Loop counter */
+    int32_t res;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        res = (*pSrcA++) + (*pSrcB++);
+        *pDst++ = (res > 0x7FFF) ? 0x7FFF : ((res < -0x8000) ? -0x8000 : res);
+        res = (*pSrcA++) + (*pSrcB++);
+        *pDst++ = (res > 0x7FFF) ? 0x7FFF : ((res < -0x8000) ? -0x8000 : res);
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        res = (*pSrcA++) + (*pSrcB++);
+        *pDst++ = (res > 0x7FFF) ? 0x7FFF : ((res < -0x8000) ? -0x8000 : res);
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicAddSatKernels group
+ */
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_sat_i8s_xpulpv2.c
+ * Description:  8-bit integer vector saturating addition kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @brief Packed saturating addition of 4 8-bit lanes.
+  @param[in]  a  first operand
+  @param[in]  b  second operand
+  @return     lane-wise saturated result
+
+  A lane overflows if both operands have the same sign and the sum has the other one. Its
+  result is then replaced by 0x7F if a is positive, or by 0x80 if a is negative.
+ */
+
+static inline v4s plp_add_sat_v4s(v4s a, v4s b) {
+    v4s res = __ADD4(a, b);
+    // all ones in the lanes that overflowed
+    v4s ovf = __SRA4((a ^ res) & (b ^ res), ((v4s){ 7, 7, 7, 7 }));
+    v4s sat = __SRA4(a, ((v4s){ 7, 7, 7, 7 })) ^ ((v4s){ 0x7F, 0x7F, 0x7F, 0x7F });
+
+    return (res & ~ovf) | (sat & ovf);
+}
+
+/**
+  @ingroup BasicAddSat
+ */
+
+/**
+  @addtogroup BasicAddSatKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element saturating addition of 8-bit integer vectors kernel for XPULPV2
+  extension.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_add_sat_i8s_xpulpv2(const int8_t *pSrcA,
+                             const int8_t *pSrcB,
+                             int8_t *pDst,
+                             uint32_t blockSize) {
+    uint32_t blkCnt; /* Loop counter */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 8 outputs at a time, 4 per packed store */
+    for (blkCnt = 0; blkCnt < (blockSize >> 3); blkCnt++) {
+        *((v4s *)pDst) = plp_add_sat_v4s(*((v4s *)pSrcA), *((v4s *)pSrcB));
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+        *((v4s *)pDst) = plp_add_sat_v4s(*((v4s *)pSrcA), *((v4s *)pSrcB));
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 8U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Compute 4 outputs at a time */
+    for (blkCnt = 0; blkCnt < (blockSize >> 2); blkCnt++) {
+        *((v4s *)pDst) = plp_add_sat_v4s(*((v4s *)pSrcA), *((v4s *)pSrcB));
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+    }
+
+    blkCnt = blockSize % 4U;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        *pDst++ = __CLIP((*pSrcA++) + (*pSrcB++), 7);
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicAddSatKernels group
+ */
@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_q16s_xpulpv2.c
+ * Description:  16-bit fixed point vector saturating multiplication kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMult
+ */
+
+/**
+  @addtogroup BasicMultKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element saturating multiplication of 16-bit fixed point vectors kernel for
+  XPULPV2 extension.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[in]     deciPoint  decimal point for right shift of the products
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Fix-Point
+  Every product is rounded to nearest, shifted right by deciPoint and saturated to the input
+  width. With two Q1.15 inputs, set deciPoint to 15 to get a Q1.15 output.
+ */
+
+void plp_mult_q16s_xpulpv2(const int16_t *pSrcA,
+                           const int16_t *pSrcB,
+                           uint32_t deciPoint,
+                           int16_t *pDst,
+                           uint32_t blockSize) {
+    uint32_t blkCnt; /* Loop counter */
+    v2s a, b;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 outputs at a time, 2 per packed store */
+    for (blkCnt = 0; blkCnt < (blockSize >> 2); blkCnt++) {
+        a = *((v2s *)pSrcA);
+        b = *((v2s *)pSrcB);
+        *((v2s *)pDst) = __PACK2(__CLIP(__ROUNDNORM_REG(a[0] * b[0], deciPoint), 15),
+                                 __CLIP(__ROUNDNORM_REG(a[1] * b[1], deciPoint), 15));
+        pSrcA += 2;
+        pSrcB += 2;
+        pDst += 2;
+        a = *((v2s *)pSrcA);
+        b = *((v2s *)pSrcB);
+        *((v2s *)pDst) = __PACK2(__CLIP(__ROUNDNORM_REG(a[0] * b[0], deciPoint), 15),
+                                 __CLIP(__ROUNDNORM_REG(a[1] * b[1], deciPoint), 15));
+        pSrcA += 2;
+        pSrcB += 2;
+        pDst += 2;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 4U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Compute 2 outputs at a time */
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        a = *((v2s *)pSrcA);
+        b = *((v2s *)pSrcB);
+        *((v2s *)pDst) = __PACK2(__CLIP(__ROUNDNORM_REG(a[0] * b[0], deciPoint), 15),
+                                 __CLIP(__ROUNDNORM_REG(a[1] * b[1], deciPoint), 15));
+        pSrcA += 2;
+        pSrcB += 2;
+        pDst += 2;
+    }
+
+    blkCnt = blockSize % 2U;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        *pDst++ = __CLIP(__ROUNDNORM_REG((*pSrcA++) * (*pSrcB++), deciPoint), 15);
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicMultKernels group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_q8s_rv32im.c
+ * Description:  8-bit fixed point vector saturating multiplication kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMult
+ */
+
+/**
+  @addtogroup BasicMultKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element saturating multiplication of 8-bit fixed point vectors kernel for
+  RV32IM extension.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[in]     deciPoint  decimal point for right shift of the products
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Fix-Point
+  Every product is rounded to nearest, shifted right by deciPoint and saturated to the input
+  width. With two Q1.7 inputs, set deciPoint to 7 to get a Q1.7 output.
+ */
+
+void plp_mult_q8s_rv32im(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         uint32_t deciPoint,
+                         int8_t *pDst,
+                         uint32_t blockSize) {
+    uint32_t blkCnt; /* Loop counter */
+    int32_t res;
+    int32_t rnd = (1 << deciPoint) >> 1; // round to nearest
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        res = ((*pSrcA++) * (*pSrcB++) + rnd) >> deciPoint;
+        *pDst++ = (res > 0x7F) ? 0x7F : ((res < -0x80) ? -0x80 : res);
+        res = ((*pSrcA++) * (*pSrcB++) + rnd) >> deciPoint;
+        *pDst++ = (res > 0x7F) ? 0x7F : ((res < -0x80) ? -0x80 : res);
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        res = ((*pSrcA++) * (*pSrcB++) + rnd) >> deciPoint;
+        *pDst++ = (res > 0x7F) ? 0x7F : ((res < -0x80) ? -0x80 : res);
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of BasicMultKernels group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_f32.c
+ * Description:  32-bit float vector multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicMult
+  @{
+ */
+
+/**
+  @brief Glue code for element-by-element multiplication of 32-bit float vectors.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  Floating point is only supported on the cluster side. On the fabric controller the function
+  prints an error message and returns without writing pDst.
+ */
+
+void plp_mult_f32(const float32_t *pSrcA,
+                  const float32_t *pSrcB,
+                  float32_t *pDst,
+                  uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mult_f32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicMult group
+ */
@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_q16.c
+ * Description:  16-bit fixed point vector saturating multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicMult
+  @{
+ */
+
+/**
+  @brief Glue code for element-by-element saturating multiplication of 16-bit fixed point vectors.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[in]     deciPoint  decimal point for right shift of the products
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par Fix-Point
+  Every product is rounded to nearest, shifted right by deciPoint and saturated to the input
+  width. With two Q1.15 inputs, set deciPoint to 15 to get a Q1.15 output.
+ */
+
+void plp_mult_q16(const int16_t *pSrcA,
+                  const int16_t *pSrcB,
+                  uint32_t deciPoint,
+                  int16_t *pDst,
+                  uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mult_q16s_rv32im(pSrcA, pSrcB, deciPoint, pDst, blockSize);
+    } else {
+        plp_mult_q16s_xpulpv2(pSrcA, pSrcB, deciPoint, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicMult group
+ */
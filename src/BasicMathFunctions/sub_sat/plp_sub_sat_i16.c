@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sub_sat_i16.c
+ * Description:  16-bit integer vector saturating subtraction glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicSubSat Saturating Vector Subtraction
+  This module contains the glue code for saturating subtraction of 8- and 16-bit vectors. The
+  kernel codes (kernels) are in the Module Saturating Vector Subtraction Kernels.
+
+  The Saturating Vector Subtraction computes the element-by-element subtraction of two vectors and
+  saturates the result to the range of the input type, so the output has the same width as the
+  inputs.
+
+  <pre>
+  pDst[n] = clip(pSrcA[n] - pSrcB[n]),   0 <= n < blockSize.
+  </pre>
+
+  Keeping the input width allows chaining element-wise operations without widening the
+  intermediate vectors, which halves (16-bit) or quarters (8-bit) the memory traffic compared to
+  the widening functions of the Module vector subtraction. The output vector may be equal to one
+  of the input vectors. Since the saturated difference of two fixed point numbers with the same
+  format does not depend on the position of the binary point, these functions can also be used for
+  q8 and q16 vectors.
+
+  On XPULPV2, the vectors are processed four (8-bit) or two (16-bit) elements at a time with
+  packed SIMD instructions. Lanes that overflowed are detected from the sign bits and replaced by
+  the largest or smallest representable value.
+ */
+
+/**
+  @addtogroup BasicSubSat
+  @{
+ */
+
+/**
+  @brief Glue code for element-by-element saturating subtraction of 16-bit integer vectors.
+  @param[in]     pSrcA      points to first input vector
+  @param[in]     pSrcB      points to second input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_sub_sat_i16(const int16_t *pSrcA,
+                     const int16_t *pSrcB,
+                     int16_t *pDst,
+                     uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_sub_sat_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize);
+    } else {
+        plp_sub_sat_i16s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicSubSat group
+ */
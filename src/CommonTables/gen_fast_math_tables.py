@@ -0,0 +1,277 @@
+#! /usr/bin/python3
+
+"""
+Generates the sine tables of the fast math functions (sinTable_f32, sinTable_q32 and sinTable_q16)
+for the table size selected in include/plp_math.h:
+
+    #define PLP_FAST_MATH_TABLE_BITS <6..12>   -> 2^bits table intervals per period
+    #define PLP_FAST_MATH_QUARTER_WAVE         -> store only [0, PI/2], 4x smaller
+
+The Makefile runs this script before every build, the output file is only rewritten when the
+configuration changed. With --report, the script instead prints the memory footprint and the
+maximum error of the sin/cos kernels for every supported table size.
+"""
+
+import os
+import re
+import sys
+import math
+import struct
+import random
+import argparse
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..')
+HEADER = os.path.join(ROOT, 'include', 'plp_math.h')
+OUTPUT = os.path.join(ROOT, 'src', 'CommonTables', 'plp_fast_math_tables.c')
+
+MIN_BITS = 6
+MAX_BITS = 12
+
+LICENSE = """/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fast_math_tables.c
+ * Description:  Sine tables of the fast math functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+"""
+
+
+def main():
+    """ Main Function """
+    parser = argparse.ArgumentParser(prog='gen_fast_math_tables',
+                                     description='Generate the fast math sine tables')
+    parser.add_argument('-r', '--report', action='store_true',
+                        help='Print memory and maximum error of all table sizes')
+    args = parser.parse_args()
+
+    if args.report:
+        report()
+        return
+
+    bits, quarter = read_config(HEADER)
+    content = generate(bits, quarter)
+
+    old = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT) as f:
+            old = f.read()
+    if old != content:
+        with open(OUTPUT, 'w') as f:
+            f.write(content)
+
+
+def read_config(header):
+    """ Reads the table configuration from plp_math.h """
+    with open(header) as f:
+        text = f.read()
+    match = re.search(r'^\s*#define\s+PLP_FAST_MATH_TABLE_BITS\s+(\d+)', text, re.MULTILINE)
+    if match is None:
+        sys.exit('gen_fast_math_tables: PLP_FAST_MATH_TABLE_BITS not found in ' + header)
+    bits = int(match.group(1))
+    if bits < MIN_BITS or bits > MAX_BITS:
+        sys.exit('gen_fast_math_tables: PLP_FAST_MATH_TABLE_BITS must be in [{}, {}]'.format(
+            MIN_BITS, MAX_BITS))
+    quarter = re.search(r'^\s*#define\s+PLP_FAST_MATH_QUARTER_WAVE\b', text, re.MULTILINE)
+    return bits, quarter is not None
+
+
+def round_half_away(x):
+    """ Rounding used for the fixed point tables """
+    return int(x + 0.5) if x > 0 else int(x - 0.5)
+
+
+def f32(x):
+    """ Rounds a double to the nearest float """
+    return struct.unpack('f', struct.pack('f', x))[0]
+
+
+def sine_values(bits):
+    """ Full period sine values (2^bits + 1 entries) in f32, q32 and q16 """
+    size = 1 << bits
+    sin = [math.sin(2 * math.pi * n / size) for n in range(size + 1)]
+    val_f32 = [round(v, 8) for v in sin]
+    val_q32 = [max(min(round_half_away(v * 2**31), 2**31 - 1), -2**31) for v in sin]
+    val_q16 = [max(min(round_half_away(v * 2**15), 2**15 - 1), -2**15) for v in sin]
+    return val_f32, val_q32, val_q16
+
+
+def c_array(ctype, name, values, fmt, per_line):
+    """ Formats a C array with aligned columns """
+    items = [fmt(v) + ',' for v in values]
+    items[-1] = items[-1][:-1]
+    width = max(len(x) for x in items)
+    lines = []
+    for i in range(0, len(items), per_line):
+        row = items[i:i + per_line]
+        lines.append('    ' + ' '.join(x.ljust(width) for x in row).rstrip())
+    return 'const {} {}[FAST_MATH_SIN_TABLE_LENGTH] = {{\n{}\n}};\n'.format(ctype, name,
+                                                                            '\n'.join(lines))
+
+
+def fmt_q32(v):
+    return '(int32_t)0x80000000' if v == -2**31 else str(v)
+
+
+def fmt_q16(v):
+    return str(v)
+
+
+def fmt_f32(v):
+    return '{:.8f}f'.format(v)
+
+
+def generate(bits, quarter):
+    """ Returns the content of plp_fast_math_tables.c """
+    size = 1 << bits
+    length = size // 4 + 2 if quarter else size + 1
+    val_f32, val_q32, val_q16 = sine_values(bits)
+
+    out = LICENSE
+    out += """
+/*
+ * Generated by src/CommonTables/gen_fast_math_tables.py for {} table intervals per period{}.
+ * Do not edit, change PLP_FAST_MATH_TABLE_BITS or PLP_FAST_MATH_QUARTER_WAVE in plp_math.h and
+ * rebuild the library instead.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+#if PLP_FAST_MATH_TABLE_BITS != {}{}
+#error "plp_fast_math_tables.c does not match the configuration in plp_math.h, rebuild with make"
+#endif
+""".format(size, ', quarter wave' if quarter else '', bits,
+           ' || !defined(PLP_FAST_MATH_QUARTER_WAVE)' if quarter else
+           ' || defined(PLP_FAST_MATH_QUARTER_WAVE)')
+
+    out += """
+/**
+  @par
+  sin(2 * PI * n / {0}) for n = 0 .. {1}
+ */
+""".format(size, length - 1)
+    out += c_array('float32_t', 'sinTable_f32', val_f32[:length], fmt_f32, 6)
+    out += """
+/**
+  @par
+  sin(2 * PI * n / {0}) for n = 0 .. {1} in Q1.31, rounded to nearest and saturated
+ */
+""".format(size, length - 1)
+    out += c_array('int32_t', 'sinTable_q32', val_q32[:length], fmt_q32, 4)
+    out += """
+/**
+  @par
+  sin(2 * PI * n / {0}) for n = 0 .. {1} in Q1.15, rounded to nearest and saturated
+ */
+""".format(size, length - 1)
+    out += c_array('int16_t', 'sinTable_q16', val_q16[:length], fmt_q16, 12)
+    return out
+
+
+def lookup(table, k, bits, quarter):
+    """ Table access of plp_sin_table_* """
+    if not quarter:
+        return table[k]
+    q = (k >> (bits - 2)) & 3
+    r = k & ((1 << (bits - 2)) - 1)
+    v = table[(1 << (bits - 2)) - r if q & 1 else r]
+    return -v if q & 2 else v
+
+
+def wrap(v, width):
+    """ Two's complement wrap around of a width bit integer """
+    v &= (1 << width) - 1
+    return v - (1 << width) if v >> (width - 1) else v
+
+
+def sin_q16(x, table, bits, quarter):
+    """ Bit exact model of plp_sin_q16s_rv32im """
+    shift = 15 - bits
+    x &= 0x7FFF
+    index = x >> shift
+    fract = (x - (index << shift)) << bits
+    a = lookup(table, index, bits, quarter)
+    b = lookup(table, index + 1, bits, quarter)
+    val = wrap(((0x8000 - fract) * a) >> 16, 16)
+    val = wrap(((val << 16) + fract * b) >> 16, 16)
+    return wrap(val << 1, 16)
+
+
+def sin_q32(x, table, bits, quarter):
+    """ Bit exact model of plp_sin_q32s_rv32im """
+    shift = 31 - bits
+    x &= 0x7FFFFFFF
+    index = x >> shift
+    fract = wrap((x - (index << shift)) << bits, 32)
+    a = lookup(table, index, bits, quarter)
+    b = lookup(table, index + 1, bits, quarter)
+    val = wrap(((0x80000000 - fract) * a) >> 32, 32)
+    val = wrap(((val << 32) + fract * b) >> 32, 32)
+    return wrap(val << 1, 32)
+
+
+def sin_f32(x, table, bits, quarter):
+    """ Model of plp_sin_f32s_xpulpv2 for x in [0, 1) periods """
+    findex = x * (1 << bits)
+    index = int(findex)
+    fract = findex - index
+    a = f32(lookup(table, index, bits, quarter))
+    b = f32(lookup(table, index + 1, bits, quarter))
+    return (1.0 - fract) * a + fract * b
+
+
+def report():
+    """ Prints memory footprint and maximum error of sin for all table sizes """
+    rng = random.Random(0)
+    samples_q32 = [rng.getrandbits(31) for _ in range(1 << 15)]
+    samples_f32 = [rng.random() for _ in range(1 << 15)]
+
+    print('{:>6} {:>11} {:>13} {:>10} {:>10} {:>10}'.format(
+        'size', 'full bytes', 'quarter bytes', 'q16 [LSB]', 'q32 [LSB]', 'f32 [abs]'))
+    for bits in range(MIN_BITS, MAX_BITS + 1):
+        size = 1 << bits
+        val_f32, val_q32, val_q16 = sine_values(bits)
+        full = (size + 1) * (4 + 4 + 2)
+        quarter = (size // 4 + 2) * (4 + 4 + 2)
+
+        err_q16 = 0.0
+        err_q32 = 0.0
+        err_f32 = 0.0
+        for layout in (False, True):
+            for x in range(1 << 15):
+                ref = math.sin(2 * math.pi * x / 2**15) * 2**15
+                err_q16 = max(err_q16, abs(sin_q16(x, val_q16, bits, layout) - ref))
+            for x in samples_q32:
+                ref = math.sin(2 * math.pi * x / 2**31) * 2**31
+                err_q32 = max(err_q32, abs(sin_q32(x, val_q32, bits, layout) - ref))
+            for x in samples_f32:
+                ref = math.sin(2 * math.pi * x)
+                err_f32 = max(err_f32, abs(sin_f32(x, val_f32, bits, layout) - ref))
+
+        print('{:>6} {:>11} {:>13} {:>10.1f} {:>10.0f} {:>10.2e}'.format(
+            size, full, quarter, err_q16, err_q32, err_f32))
+
+
+if __name__ == '__main__':
+    main()
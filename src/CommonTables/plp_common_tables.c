@@ -8025,698 +8025,314 @@ short bit_rev_radix2_LUT[2048] = {
 };
 
 /**
-  @par
-  Example code for the generation of the floating-point sine table:
-  <pre>
-  tableSize = 512;
-  for (n = 0; n < (tableSize + 1); n++)
-  {
-  sinTable[n] = sin(2*PI*n/tableSize);
-  }</pre>
- @par
-  where PI value is  3.14159265358979
+ * @brief Seeds of 1 / sqrt(m) in Q1.15 (unsigned) for m in [0.25, 1), where entry i covers
+ * m in [(16 + i) / 64, (17 + i) / 64) and holds the value at the center of that range.
  */
-const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
-    0.00000000f,  0.01227154f,  0.02454123f,  0.03680722f,  0.04906767f,  0.06132074f,
-    0.07356456f,  0.08579731f,  0.09801714f,  0.11022221f,  0.12241068f,  0.13458071f,
-    0.14673047f,  0.15885814f,  0.17096189f,  0.18303989f,  0.19509032f,  0.20711138f,
-    0.21910124f,  0.23105811f,  0.24298018f,  0.25486566f,  0.26671276f,  0.27851969f,
-    0.29028468f,  0.30200595f,  0.31368174f,  0.32531029f,  0.33688985f,  0.34841868f,
-    0.35989504f,  0.37131719f,  0.38268343f,  0.39399204f,  0.40524131f,  0.41642956f,
-    0.42755509f,  0.43861624f,  0.44961133f,  0.46053871f,  0.47139674f,  0.48218377f,
-    0.49289819f,  0.50353838f,  0.51410274f,  0.52458968f,  0.53499762f,  0.54532499f,
-    0.55557023f,  0.56573181f,  0.57580819f,  0.58579786f,  0.59569930f,  0.60551104f,
-    0.61523159f,  0.62485949f,  0.63439328f,  0.64383154f,  0.65317284f,  0.66241578f,
-    0.67155895f,  0.68060100f,  0.68954054f,  0.69837625f,  0.70710678f,  0.71573083f,
-    0.72424708f,  0.73265427f,  0.74095113f,  0.74913639f,  0.75720885f,  0.76516727f,
-    0.77301045f,  0.78073723f,  0.78834643f,  0.79583690f,  0.80320753f,  0.81045720f,
-    0.81758481f,  0.82458930f,  0.83146961f,  0.83822471f,  0.84485357f,  0.85135519f,
-    0.85772861f,  0.86397286f,  0.87008699f,  0.87607009f,  0.88192126f,  0.88763962f,
-    0.89322430f,  0.89867447f,  0.90398929f,  0.90916798f,  0.91420976f,  0.91911385f,
-    0.92387953f,  0.92850608f,  0.93299280f,  0.93733901f,  0.94154407f,  0.94560733f,
-    0.94952818f,  0.95330604f,  0.95694034f,  0.96043052f,  0.96377607f,  0.96697647f,
-    0.97003125f,  0.97293995f,  0.97570213f,  0.97831737f,  0.98078528f,  0.98310549f,
-    0.98527764f,  0.98730142f,  0.98917651f,  0.99090264f,  0.99247953f,  0.99390697f,
-    0.99518473f,  0.99631261f,  0.99729046f,  0.99811811f,  0.99879546f,  0.99932238f,
-    0.99969882f,  0.99992470f,  1.00000000f,  0.99992470f,  0.99969882f,  0.99932238f,
-    0.99879546f,  0.99811811f,  0.99729046f,  0.99631261f,  0.99518473f,  0.99390697f,
-    0.99247953f,  0.99090264f,  0.98917651f,  0.98730142f,  0.98527764f,  0.98310549f,
-    0.98078528f,  0.97831737f,  0.97570213f,  0.97293995f,  0.97003125f,  0.96697647f,
-    0.96377607f,  0.96043052f,  0.95694034f,  0.95330604f,  0.94952818f,  0.94560733f,
-    0.94154407f,  0.93733901f,  0.93299280f,  0.92850608f,  0.92387953f,  0.91911385f,
-    0.91420976f,  0.90916798f,  0.90398929f,  0.89867447f,  0.89322430f,  0.88763962f,
-    0.88192126f,  0.87607009f,  0.87008699f,  0.86397286f,  0.85772861f,  0.85135519f,
-    0.84485357f,  0.83822471f,  0.83146961f,  0.82458930f,  0.81758481f,  0.81045720f,
-    0.80320753f,  0.79583690f,  0.78834643f,  0.78073723f,  0.77301045f,  0.76516727f,
-    0.75720885f,  0.74913639f,  0.74095113f,  0.73265427f,  0.72424708f,  0.71573083f,
-    0.70710678f,  0.69837625f,  0.68954054f,  0.68060100f,  0.67155895f,  0.66241578f,
-    0.65317284f,  0.64383154f,  0.63439328f,  0.62485949f,  0.61523159f,  0.60551104f,
-    0.59569930f,  0.58579786f,  0.57580819f,  0.56573181f,  0.55557023f,  0.54532499f,
-    0.53499762f,  0.52458968f,  0.51410274f,  0.50353838f,  0.49289819f,  0.48218377f,
-    0.47139674f,  0.46053871f,  0.44961133f,  0.43861624f,  0.42755509f,  0.41642956f,
-    0.40524131f,  0.39399204f,  0.38268343f,  0.37131719f,  0.35989504f,  0.34841868f,
-    0.33688985f,  0.32531029f,  0.31368174f,  0.30200595f,  0.29028468f,  0.27851969f,
-    0.26671276f,  0.25486566f,  0.24298018f,  0.23105811f,  0.21910124f,  0.20711138f,
-    0.19509032f,  0.18303989f,  0.17096189f,  0.15885814f,  0.14673047f,  0.13458071f,
-    0.12241068f,  0.11022221f,  0.09801714f,  0.08579731f,  0.07356456f,  0.06132074f,
-    0.04906767f,  0.03680722f,  0.02454123f,  0.01227154f,  0.00000000f,  -0.01227154f,
-    -0.02454123f, -0.03680722f, -0.04906767f, -0.06132074f, -0.07356456f, -0.08579731f,
-    -0.09801714f, -0.11022221f, -0.12241068f, -0.13458071f, -0.14673047f, -0.15885814f,
-    -0.17096189f, -0.18303989f, -0.19509032f, -0.20711138f, -0.21910124f, -0.23105811f,
-    -0.24298018f, -0.25486566f, -0.26671276f, -0.27851969f, -0.29028468f, -0.30200595f,
-    -0.31368174f, -0.32531029f, -0.33688985f, -0.34841868f, -0.35989504f, -0.37131719f,
-    -0.38268343f, -0.39399204f, -0.40524131f, -0.41642956f, -0.42755509f, -0.43861624f,
-    -0.44961133f, -0.46053871f, -0.47139674f, -0.48218377f, -0.49289819f, -0.50353838f,
-    -0.51410274f, -0.52458968f, -0.53499762f, -0.54532499f, -0.55557023f, -0.56573181f,
-    -0.57580819f, -0.58579786f, -0.59569930f, -0.60551104f, -0.61523159f, -0.62485949f,
-    -0.63439328f, -0.64383154f, -0.65317284f, -0.66241578f, -0.67155895f, -0.68060100f,
-    -0.68954054f, -0.69837625f, -0.70710678f, -0.71573083f, -0.72424708f, -0.73265427f,
-    -0.74095113f, -0.74913639f, -0.75720885f, -0.76516727f, -0.77301045f, -0.78073723f,
-    -0.78834643f, -0.79583690f, -0.80320753f, -0.81045720f, -0.81758481f, -0.82458930f,
-    -0.83146961f, -0.83822471f, -0.84485357f, -0.85135519f, -0.85772861f, -0.86397286f,
-    -0.87008699f, -0.87607009f, -0.88192126f, -0.88763962f, -0.89322430f, -0.89867447f,
-    -0.90398929f, -0.90916798f, -0.91420976f, -0.91911385f, -0.92387953f, -0.92850608f,
-    -0.93299280f, -0.93733901f, -0.94154407f, -0.94560733f, -0.94952818f, -0.95330604f,
-    -0.95694034f, -0.96043052f, -0.96377607f, -0.96697647f, -0.97003125f, -0.97293995f,
-    -0.97570213f, -0.97831737f, -0.98078528f, -0.98310549f, -0.98527764f, -0.98730142f,
-    -0.98917651f, -0.99090264f, -0.99247953f, -0.99390697f, -0.99518473f, -0.99631261f,
-    -0.99729046f, -0.99811811f, -0.99879546f, -0.99932238f, -0.99969882f, -0.99992470f,
-    -1.00000000f, -0.99992470f, -0.99969882f, -0.99932238f, -0.99879546f, -0.99811811f,
-    -0.99729046f, -0.99631261f, -0.99518473f, -0.99390697f, -0.99247953f, -0.99090264f,
-    -0.98917651f, -0.98730142f, -0.98527764f, -0.98310549f, -0.98078528f, -0.97831737f,
-    -0.97570213f, -0.97293995f, -0.97003125f, -0.96697647f, -0.96377607f, -0.96043052f,
-    -0.95694034f, -0.95330604f, -0.94952818f, -0.94560733f, -0.94154407f, -0.93733901f,
-    -0.93299280f, -0.92850608f, -0.92387953f, -0.91911385f, -0.91420976f, -0.90916798f,
-    -0.90398929f, -0.89867447f, -0.89322430f, -0.88763962f, -0.88192126f, -0.87607009f,
-    -0.87008699f, -0.86397286f, -0.85772861f, -0.85135519f, -0.84485357f, -0.83822471f,
-    -0.83146961f, -0.82458930f, -0.81758481f, -0.81045720f, -0.80320753f, -0.79583690f,
-    -0.78834643f, -0.78073723f, -0.77301045f, -0.76516727f, -0.75720885f, -0.74913639f,
-    -0.74095113f, -0.73265427f, -0.72424708f, -0.71573083f, -0.70710678f, -0.69837625f,
-    -0.68954054f, -0.68060100f, -0.67155895f, -0.66241578f, -0.65317284f, -0.64383154f,
-    -0.63439328f, -0.62485949f, -0.61523159f, -0.60551104f, -0.59569930f, -0.58579786f,
-    -0.57580819f, -0.56573181f, -0.55557023f, -0.54532499f, -0.53499762f, -0.52458968f,
-    -0.51410274f, -0.50353838f, -0.49289819f, -0.48218377f, -0.47139674f, -0.46053871f,
-    -0.44961133f, -0.43861624f, -0.42755509f, -0.41642956f, -0.40524131f, -0.39399204f,
-    -0.38268343f, -0.37131719f, -0.35989504f, -0.34841868f, -0.33688985f, -0.32531029f,
-    -0.31368174f, -0.30200595f, -0.29028468f, -0.27851969f, -0.26671276f, -0.25486566f,
-    -0.24298018f, -0.23105811f, -0.21910124f, -0.20711138f, -0.19509032f, -0.18303989f,
-    -0.17096189f, -0.15885814f, -0.14673047f, -0.13458071f, -0.12241068f, -0.11022221f,
-    -0.09801714f, -0.08579731f, -0.07356456f, -0.06132074f, -0.04906767f, -0.03680722f,
-    -0.02454123f, -0.01227154f, -0.00000000f
+const uint16_t rsqrtTable_q16[RSQRT_TABLE_SIZE] = {
+    64535, 62664, 60947, 59364, 57898, 56535, 55265, 54076, 52961, 51912, 50923, 49989,
+    49104, 48265, 47467, 46707, 45983, 45292, 44630, 43997, 43390, 42808, 42248, 41710,
+    41192, 40693, 40211, 39746, 39297, 38863, 38443, 38036, 37642, 37260, 36889, 36529,
+    36179, 35840, 35509, 35188, 34875, 34571, 34274, 33985, 33703, 33427, 33159, 32897
 };
 
 /**
-  @par
-  Table values are in q32 (1.31 fixed-point format) and generation is done in
-  three steps.  First, generate sin values in floating point:
-  <pre>
-  tableSize = 512;
-  for (n = 0; n < (tableSize + 1); n++)
-  {
-  sinTable[n] = sin(2*PI*n/tableSize);
-  } </pre>
-  where PI value is 3.14159265358979
- @par
-  Second, convert floating-point to q32 (Fixed point):
-  (sinTable[i] * pow(2, 31))
- @par
-  Finally, round to the nearest integer value:
-    sinTable[i] += (sinTable[i] > 0 ? 0.5 : -0.5);
+ * @brief 2^(i / 32) in Q2.30
  */
-const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1] = { 0L,
-                                                         26352928L,
-                                                         52701887L,
-                                                         79042909L,
-                                                         105372028L,
-                                                         131685278L,
-                                                         157978697L,
-                                                         184248325L,
-                                                         210490206L,
-                                                         236700388L,
-                                                         262874923L,
-                                                         289009871L,
-                                                         315101295L,
-                                                         341145265L,
-                                                         367137861L,
-                                                         393075166L,
-                                                         418953276L,
-                                                         444768294L,
-                                                         470516330L,
-                                                         496193509L,
-                                                         521795963L,
-                                                         547319836L,
-                                                         572761285L,
-                                                         598116479L,
-                                                         623381598L,
-                                                         648552838L,
-                                                         673626408L,
-                                                         698598533L,
-                                                         723465451L,
-                                                         748223418L,
-                                                         772868706L,
-                                                         797397602L,
-                                                         821806413L,
-                                                         846091463L,
-                                                         870249095L,
-                                                         894275671L,
-                                                         918167572L,
-                                                         941921200L,
-                                                         965532978L,
-                                                         988999351L,
-                                                         1012316784L,
-                                                         1035481766L,
-                                                         1058490808L,
-                                                         1081340445L,
-                                                         1104027237L,
-                                                         1126547765L,
-                                                         1148898640L,
-                                                         1171076495L,
-                                                         1193077991L,
-                                                         1214899813L,
-                                                         1236538675L,
-                                                         1257991320L,
-                                                         1279254516L,
-                                                         1300325060L,
-                                                         1321199781L,
-                                                         1341875533L,
-                                                         1362349204L,
-                                                         1382617710L,
-                                                         1402678000L,
-                                                         1422527051L,
-                                                         1442161874L,
-                                                         1461579514L,
-                                                         1480777044L,
-                                                         1499751576L,
-                                                         1518500250L,
-                                                         1537020244L,
-                                                         1555308768L,
-                                                         1573363068L,
-                                                         1591180426L,
-                                                         1608758157L,
-                                                         1626093616L,
-                                                         1643184191L,
-                                                         1660027308L,
-                                                         1676620432L,
-                                                         1692961062L,
-                                                         1709046739L,
-                                                         1724875040L,
-                                                         1740443581L,
-                                                         1755750017L,
-                                                         1770792044L,
-                                                         1785567396L,
-                                                         1800073849L,
-                                                         1814309216L,
-                                                         1828271356L,
-                                                         1841958164L,
-                                                         1855367581L,
-                                                         1868497586L,
-                                                         1881346202L,
-                                                         1893911494L,
-                                                         1906191570L,
-                                                         1918184581L,
-                                                         1929888720L,
-                                                         1941302225L,
-                                                         1952423377L,
-                                                         1963250501L,
-                                                         1973781967L,
-                                                         1984016189L,
-                                                         1993951625L,
-                                                         2003586779L,
-                                                         2012920201L,
-                                                         2021950484L,
-                                                         2030676269L,
-                                                         2039096241L,
-                                                         2047209133L,
-                                                         2055013723L,
-                                                         2062508835L,
-                                                         2069693342L,
-                                                         2076566160L,
-                                                         2083126254L,
-                                                         2089372638L,
-                                                         2095304370L,
-                                                         2100920556L,
-                                                         2106220352L,
-                                                         2111202959L,
-                                                         2115867626L,
-                                                         2120213651L,
-                                                         2124240380L,
-                                                         2127947206L,
-                                                         2131333572L,
-                                                         2134398966L,
-                                                         2137142927L,
-                                                         2139565043L,
-                                                         2141664948L,
-                                                         2143442326L,
-                                                         2144896910L,
-                                                         2146028480L,
-                                                         2146836866L,
-                                                         2147321946L,
-                                                         2147483647L,
-                                                         2147321946L,
-                                                         2146836866L,
-                                                         2146028480L,
-                                                         2144896910L,
-                                                         2143442326L,
-                                                         2141664948L,
-                                                         2139565043L,
-                                                         2137142927L,
-                                                         2134398966L,
-                                                         2131333572L,
-                                                         2127947206L,
-                                                         2124240380L,
-                                                         2120213651L,
-                                                         2115867626L,
-                                                         2111202959L,
-                                                         2106220352L,
-                                                         2100920556L,
-                                                         2095304370L,
-                                                         2089372638L,
-                                                         2083126254L,
-                                                         2076566160L,
-                                                         2069693342L,
-                                                         2062508835L,
-                                                         2055013723L,
-                                                         2047209133L,
-                                                         2039096241L,
-                                                         2030676269L,
-                                                         2021950484L,
-                                                         2012920201L,
-                                                         2003586779L,
-                                                         1993951625L,
-                                                         1984016189L,
-                                                         1973781967L,
-                                                         1963250501L,
-                                                         1952423377L,
-                                                         1941302225L,
-                                                         1929888720L,
-                                                         1918184581L,
-                                                         1906191570L,
-                                                         1893911494L,
-                                                         1881346202L,
-                                                         1868497586L,
-                                                         1855367581L,
-                                                         1841958164L,
-                                                         1828271356L,
-                                                         1814309216L,
-                                                         1800073849L,
-                                                         1785567396L,
-                                                         1770792044L,
-                                                         1755750017L,
-                                                         1740443581L,
-                                                         1724875040L,
-                                                         1709046739L,
-                                                         1692961062L,
-                                                         1676620432L,
-                                                         1660027308L,
-                                                         1643184191L,
-                                                         1626093616L,
-                                                         1608758157L,
-                                                         1591180426L,
-                                                         1573363068L,
-                                                         1555308768L,
-                                                         1537020244L,
-                                                         1518500250L,
-                                                         1499751576L,
-                                                         1480777044L,
-                                                         1461579514L,
-                                                         1442161874L,
-                                                         1422527051L,
-                                                         1402678000L,
-                                                         1382617710L,
-                                                         1362349204L,
-                                                         1341875533L,
-                                                         1321199781L,
-                                                         1300325060L,
-                                                         1279254516L,
-                                                         1257991320L,
-                                                         1236538675L,
-                                                         1214899813L,
-                                                         1193077991L,
-                                                         1171076495L,
-                                                         1148898640L,
-                                                         1126547765L,
-                                                         1104027237L,
-                                                         1081340445L,
-                                                         1058490808L,
-                                                         1035481766L,
-                                                         1012316784L,
-                                                         988999351L,
-                                                         965532978L,
-                                                         941921200L,
-                                                         918167572L,
-                                                         894275671L,
-                                                         870249095L,
-                                                         846091463L,
-                                                         821806413L,
-                                                         797397602L,
-                                                         772868706L,
-                                                         748223418L,
-                                                         723465451L,
-                                                         698598533L,
-                                                         673626408L,
-                                                         648552838L,
-                                                         623381598L,
-                                                         598116479L,
-                                                         572761285L,
-                                                         547319836L,
-                                                         521795963L,
-                                                         496193509L,
-                                                         470516330L,
-                                                         444768294L,
-                                                         418953276L,
-                                                         393075166L,
-                                                         367137861L,
-                                                         341145265L,
-                                                         315101295L,
-                                                         289009871L,
-                                                         262874923L,
-                                                         236700388L,
-                                                         210490206L,
-                                                         184248325L,
-                                                         157978697L,
-                                                         131685278L,
-                                                         105372028L,
-                                                         79042909L,
-                                                         52701887L,
-                                                         26352928L,
-                                                         0L,
-                                                         -26352928L,
-                                                         -52701887L,
-                                                         -79042909L,
-                                                         -105372028L,
-                                                         -131685278L,
-                                                         -157978697L,
-                                                         -184248325L,
-                                                         -210490206L,
-                                                         -236700388L,
-                                                         -262874923L,
-                                                         -289009871L,
-                                                         -315101295L,
-                                                         -341145265L,
-                                                         -367137861L,
-                                                         -393075166L,
-                                                         -418953276L,
-                                                         -444768294L,
-                                                         -470516330L,
-                                                         -496193509L,
-                                                         -521795963L,
-                                                         -547319836L,
-                                                         -572761285L,
-                                                         -598116479L,
-                                                         -623381598L,
-                                                         -648552838L,
-                                                         -673626408L,
-                                                         -698598533L,
-                                                         -723465451L,
-                                                         -748223418L,
-                                                         -772868706L,
-                                                         -797397602L,
-                                                         -821806413L,
-                                                         -846091463L,
-                                                         -870249095L,
-                                                         -894275671L,
-                                                         -918167572L,
-                                                         -941921200L,
-                                                         -965532978L,
-                                                         -988999351L,
-                                                         -1012316784L,
-                                                         -1035481766L,
-                                                         -1058490808L,
-                                                         -1081340445L,
-                                                         -1104027237L,
-                                                         -1126547765L,
-                                                         -1148898640L,
-                                                         -1171076495L,
-                                                         -1193077991L,
-                                                         -1214899813L,
-                                                         -1236538675L,
-                                                         -1257991320L,
-                                                         -1279254516L,
-                                                         -1300325060L,
-                                                         -1321199781L,
-                                                         -1341875533L,
-                                                         -1362349204L,
-                                                         -1382617710L,
-                                                         -1402678000L,
-                                                         -1422527051L,
-                                                         -1442161874L,
-                                                         -1461579514L,
-                                                         -1480777044L,
-                                                         -1499751576L,
-                                                         -1518500250L,
-                                                         -1537020244L,
-                                                         -1555308768L,
-                                                         -1573363068L,
-                                                         -1591180426L,
-                                                         -1608758157L,
-                                                         -1626093616L,
-                                                         -1643184191L,
-                                                         -1660027308L,
-                                                         -1676620432L,
-                                                         -1692961062L,
-                                                         -1709046739L,
-                                                         -1724875040L,
-                                                         -1740443581L,
-                                                         -1755750017L,
-                                                         -1770792044L,
-                                                         -1785567396L,
-                                                         -1800073849L,
-                                                         -1814309216L,
-                                                         -1828271356L,
-                                                         -1841958164L,
-                                                         -1855367581L,
-                                                         -1868497586L,
-                                                         -1881346202L,
-                                                         -1893911494L,
-                                                         -1906191570L,
-                                                         -1918184581L,
-                                                         -1929888720L,
-                                                         -1941302225L,
-                                                         -1952423377L,
-                                                         -1963250501L,
-                                                         -1973781967L,
-                                                         -1984016189L,
-                                                         -1993951625L,
-                                                         -2003586779L,
-                                                         -2012920201L,
-                                                         -2021950484L,
-                                                         -2030676269L,
-                                                         -2039096241L,
-                                                         -2047209133L,
-                                                         -2055013723L,
-                                                         -2062508835L,
-                                                         -2069693342L,
-                                                         -2076566160L,
-                                                         -2083126254L,
-                                                         -2089372638L,
-                                                         -2095304370L,
-                                                         -2100920556L,
-                                                         -2106220352L,
-                                                         -2111202959L,
-                                                         -2115867626L,
-                                                         -2120213651L,
-                                                         -2124240380L,
-                                                         -2127947206L,
-                                                         -2131333572L,
-                                                         -2134398966L,
-                                                         -2137142927L,
-                                                         -2139565043L,
-                                                         -2141664948L,
-                                                         -2143442326L,
-                                                         -2144896910L,
-                                                         -2146028480L,
-                                                         -2146836866L,
-                                                         -2147321946L,
-                                                         (int32_t)0x80000000,
-                                                         -2147321946L,
-                                                         -2146836866L,
-                                                         -2146028480L,
-                                                         -2144896910L,
-                                                         -2143442326L,
-                                                         -2141664948L,
-                                                         -2139565043L,
-                                                         -2137142927L,
-                                                         -2134398966L,
-                                                         -2131333572L,
-                                                         -2127947206L,
-                                                         -2124240380L,
-                                                         -2120213651L,
-                                                         -2115867626L,
-                                                         -2111202959L,
-                                                         -2106220352L,
-                                                         -2100920556L,
-                                                         -2095304370L,
-                                                         -2089372638L,
-                                                         -2083126254L,
-                                                         -2076566160L,
-                                                         -2069693342L,
-                                                         -2062508835L,
-                                                         -2055013723L,
-                                                         -2047209133L,
-                                                         -2039096241L,
-                                                         -2030676269L,
-                                                         -2021950484L,
-                                                         -2012920201L,
-                                                         -2003586779L,
-                                                         -1993951625L,
-                                                         -1984016189L,
-                                                         -1973781967L,
-                                                         -1963250501L,
-                                                         -1952423377L,
-                                                         -1941302225L,
-                                                         -1929888720L,
-                                                         -1918184581L,
-                                                         -1906191570L,
-                                                         -1893911494L,
-                                                         -1881346202L,
-                                                         -1868497586L,
-                                                         -1855367581L,
-                                                         -1841958164L,
-                                                         -1828271356L,
-                                                         -1814309216L,
-                                                         -1800073849L,
-                                                         -1785567396L,
-                                                         -1770792044L,
-                                                         -1755750017L,
-                                                         -1740443581L,
-                                                         -1724875040L,
-                                                         -1709046739L,
-                                                         -1692961062L,
-                                                         -1676620432L,
-                                                         -1660027308L,
-                                                         -1643184191L,
-                                                         -1626093616L,
-                                                         -1608758157L,
-                                                         -1591180426L,
-                                                         -1573363068L,
-                                                         -1555308768L,
-                                                         -1537020244L,
-                                                         -1518500250L,
-                                                         -1499751576L,
-                                                         -1480777044L,
-                                                         -1461579514L,
-                                                         -1442161874L,
-                                                         -1422527051L,
-                                                         -1402678000L,
-                                                         -1382617710L,
-                                                         -1362349204L,
-                                                         -1341875533L,
-                                                         -1321199781L,
-                                                         -1300325060L,
-                                                         -1279254516L,
-                                                         -1257991320L,
-                                                         -1236538675L,
-                                                         -1214899813L,
-                                                         -1193077991L,
-                                                         -1171076495L,
-                                                         -1148898640L,
-                                                         -1126547765L,
-                                                         -1104027237L,
-                                                         -1081340445L,
-                                                         -1058490808L,
-                                                         -1035481766L,
-                                                         -1012316784L,
-                                                         -988999351L,
-                                                         -965532978L,
-                                                         -941921200L,
-                                                         -918167572L,
-                                                         -894275671L,
-                                                         -870249095L,
-                                                         -846091463L,
-                                                         -821806413L,
-                                                         -797397602L,
-                                                         -772868706L,
-                                                         -748223418L,
-                                                         -723465451L,
-                                                         -698598533L,
-                                                         -673626408L,
-                                                         -648552838L,
-                                                         -623381598L,
-                                                         -598116479L,
-                                                         -572761285L,
-                                                         -547319836L,
-                                                         -521795963L,
-                                                         -496193509L,
-                                                         -470516330L,
-                                                         -444768294L,
-                                                         -418953276L,
-                                                         -393075166L,
-                                                         -367137861L,
-                                                         -341145265L,
-                                                         -315101295L,
-                                                         -289009871L,
-                                                         -262874923L,
-                                                         -236700388L,
-                                                         -210490206L,
-                                                         -184248325L,
-                                                         -157978697L,
-                                                         -131685278L,
-                                                         -105372028L,
-                                                         -79042909L,
-                                                         -52701887L,
-                                                         -26352928L,
-                                                         0 };
+const int32_t exp2Table_q32[FAST_MATH_EXP_TABLE_SIZE] = {
+    1073741824, 1097253708, 1121280436, 1145833280, 1170923762, 1196563654,
+    1222764986, 1249540052, 1276901417, 1304861917, 1333434672, 1362633090,
+    1392470869, 1422962010, 1454120821, 1485961921, 1518500250, 1551751076,
+    1585730000, 1620452965, 1655936265, 1692196547, 1729250827, 1767116489,
+    1805811301, 1845353420, 1885761398, 1927054196, 1969251188, 2012372174,
+    2056437387, 2101467502
+};
 
 /**
-  @par
-  Table values are in Q15 (1.15 fixed-point format) and generation is done in
-  three steps.  First,  generate sin values in floating point:
-  <pre>
-  tableSize = 512;
-  for (n = 0; n < (tableSize + 1); n++)
-  {
-  sinTable[n] = sin(2*PI*n/tableSize);
-  } </pre>
-  where PI value is  3.14159265358979
- @par
-  Second, convert floating-point to Q15 (Fixed point):
-  (sinTable[i] * pow(2, 15))
- @par
-  Finally, round to the nearest integer value:
-    sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);
+ * @brief 2^(i / 32)
+ */
+const float32_t exp2Table_f32[FAST_MATH_EXP_TABLE_SIZE] = {
+    1.00000000f, 1.02189715f, 1.04427378f, 1.06714040f, 1.09050773f, 1.11438674f,
+    1.13878863f, 1.16372486f, 1.18920712f, 1.21524736f, 1.24185781f, 1.26905096f,
+    1.29683955f, 1.32523664f, 1.35425555f, 1.38390988f, 1.41421356f, 1.44518081f,
+    1.47682615f, 1.50916443f, 1.54221083f, 1.57598085f, 1.61049033f, 1.64575548f,
+    1.68179283f, 1.71861930f, 1.75625216f, 1.79470908f, 1.83400809f, 1.87416763f,
+    1.91520656f, 1.95714412f
+};
+
+/**
+ * @brief ln(1 + i / 32) in Q2.30
+ */
+const int32_t logTable_q32[FAST_MATH_LOG_TABLE_SIZE] = {
+    0,         33040817,  65095192,  96220323,  126468572, 155887996,
+    184522808, 212413774, 239598564, 266112055, 291986604, 317252283,
+    341937090, 366067135, 389666807, 412758919, 435364845, 457504636,
+    479197128, 500460037, 521310048, 541762891, 561833416, 581535654,
+    600882877, 619887653, 638561895, 656916903, 674963409, 692711611,
+    710171213, 727351448
+};
+
+/**
+ * @brief ln(1 + i / 32)
+ */
+const float32_t logTable_f32[FAST_MATH_LOG_TABLE_SIZE] = {
+    0.00000000f, 0.03077166f, 0.06062462f, 0.08961216f, 0.11778304f, 0.14518201f,
+    0.17185026f, 0.19782574f, 0.22314355f, 0.24783616f, 0.27193372f, 0.29546421f,
+    0.31845373f, 0.34092659f, 0.36290549f, 0.38441170f, 0.40546511f, 0.42608440f,
+    0.44628710f, 0.46608973f, 0.48550782f, 0.50455601f, 0.52324814f, 0.54159728f,
+    0.55961579f, 0.57731537f, 0.59470711f, 0.61180154f, 0.62860866f, 0.64513796f,
+    0.66139848f, 0.67739882f
+};
+
+/**
+ * @brief 1 / (1 + i / 32) in Q2.30
+ */
+const int32_t recipTable_q32[FAST_MATH_LOG_TABLE_SIZE] = {
+    1073741824, 1041204193, 1010580540, 981706811,  954437177,  928641578,
+    904203641,  881018933,  858993459,  838042399,  818089009,  799063683,
+    780903145,  763549742,  746950834,  731058263,  715827883,  701219150,
+    687194767,  673720360,  660764199,  648296950,  636291451,  624722516,
+    613566757,  602802428,  592409282,  582368447,  572662306,  563274399,
+    554189329,  545392673
+};
+
+/**
+ * @brief 1 / (1 + i / 32)
+ */
+const float32_t recipTable_f32[FAST_MATH_LOG_TABLE_SIZE] = {
+    1.00000000f, 0.96969697f, 0.94117647f, 0.91428571f, 0.88888889f, 0.86486486f,
+    0.84210526f, 0.82051282f, 0.80000000f, 0.78048780f, 0.76190476f, 0.74418605f,
+    0.72727273f, 0.71111111f, 0.69565217f, 0.68085106f, 0.66666667f, 0.65306122f,
+    0.64000000f, 0.62745098f, 0.61538462f, 0.60377358f, 0.59259259f, 0.58181818f,
+    0.57142857f, 0.56140351f, 0.55172414f, 0.54237288f, 0.53333333f, 0.52459016f,
+    0.51612903f, 0.50793651f
+};
+
+/**
+ * @brief log2(1 + i / 64) in Q2.30
+ */
+const int32_t log2Table_q32[FAST_MATH_LOG2_TABLE_SIZE + 1] = {
+    0,          24017256,   47667823,   70962728,   93912511,   116527248,
+    138816582,  160789745,  182455581,  203822568,  224898839,  245692198,
+    266210141,  286459867,  306448299,  326182095,  345667660,  364911162,
+    383918542,  402695523,  421247625,  439580170,  457698295,  475606957,
+    493310944,  510814882,  528123241,  545240343,  562170370,  578917365,
+    595485245,  611877800,  628098702,  644151509,  660039669,  675766525,
+    691335320,  706749198,  722011213,  737124328,  752091421,  766915285,
+    781598637,  796144114,  810554283,  824831638,  838978604,  852997541,
+    866890747,  880660455,  894308843,  907838029,  921250079,  934547002,
+    947730758,  960803257,  973766362,  986621888,  999371606,  1012017244,
+    1024560487, 1037002979, 1049346328, 1061592099, 1073741824
+};
+
+/**
+ * @brief log2(1 + i / 64)
+ */
+const float32_t log2Table_f32[FAST_MATH_LOG2_TABLE_SIZE + 1] = {
+    0.00000000f, 0.02236781f, 0.04439412f, 0.06608919f, 0.08746284f, 0.10852446f,
+    0.12928302f, 0.14974712f, 0.16992500f, 0.18982456f, 0.20945337f, 0.22881869f,
+    0.24792751f, 0.26678654f, 0.28540222f, 0.30378075f, 0.32192809f, 0.33985000f,
+    0.35755200f, 0.37503943f, 0.39231742f, 0.40939094f, 0.42626475f, 0.44294350f,
+    0.45943162f, 0.47573343f, 0.49185310f, 0.50779464f, 0.52356196f, 0.53915881f,
+    0.55458885f, 0.56985561f, 0.58496250f, 0.59991284f, 0.61470984f, 0.62935662f,
+    0.64385619f, 0.65821148f, 0.67242534f, 0.68650053f, 0.70043972f, 0.71424552f,
+    0.72792045f, 0.74146699f, 0.75488750f, 0.76818432f, 0.78135971f, 0.79441587f,
+    0.80735492f, 0.82017896f, 0.83289001f, 0.84549005f, 0.85798100f, 0.87036472f,
+    0.88264305f, 0.89481776f, 0.90689060f, 0.91886324f, 0.93073734f, 0.94251451f,
+    0.95419631f, 0.96578428f, 0.97727992f, 0.98868469f, 1.00000000f
+};
+
+/**
+ * @brief {alpha, beta} pairs of the alpha-max-plus-beta-min magnitude with 1, 2 and 4 segments
+ *        of the first octant, in Q1.15
+ */
+const int16_t magFastCoef_q16[PLP_CMPLX_MAG_FAST_COEF_LENGTH] = {
+    31471, 13036,
+    32450, 6455,
+    27510, 18382,
+    32689, 3220,
+    31433, 9535,
+    28969, 15484,
+    25391, 20838
+};
+
+/**
+ * @brief {alpha, beta} pairs of the alpha-max-plus-beta-min magnitude with 1, 2 and 4 segments
+ *        of the first octant, in Q1.31
+ */
+const int32_t magFastCoef_q32[PLP_CMPLX_MAG_FAST_COEF_LENGTH] = {
+    2062516031, 854322113,
+    2126651861, 423017356,
+    1802888394, 1204651511,
+    2142300809, 210998213,
+    2059973391, 624886096,
+    1898482350, 1014759957,
+    1664033697, 1365637162
+};
+
+/**
+ * @brief {alpha, beta} pairs of the alpha-max-plus-beta-min magnitude with 1, 2 and 4 segments
+ *        of the first octant
+ */
+const float32_t magFastCoef_f32[PLP_CMPLX_MAG_FAST_COEF_LENGTH] = {
+    0.96043387f, 0.39782473f,
+    0.99029944f, 0.19698281f,
+    0.83953533f, 0.56095957f,
+    0.99758655f, 0.09825370f,
+    0.95924986f, 0.29098526f,
+    0.88404973f, 0.47253443f,
+    0.77487607f, 0.63592436f
+};
+
+/**
+ * @brief atan(i / 256) / (2 * PI) in Q1.31, i.e. in turns
+ */
+const int32_t atanTable_q32[FAST_MATH_ATAN_TABLE_SIZE + 1] = {
+    0,         1335082,   2670123,   4005082,   5339919,   6674594,
+    8009064,   9343291,   10677233,  12010849,  13344100,  14676944,
+    16009342,  17341254,  18672638,  20003455,  21333666,  22663229,
+    23992106,  25320257,  26647642,  27974222,  29299958,  30624810,
+    31948741,  33271710,  34593681,  35914613,  37234469,  38553212,
+    39870802,  41187204,  42502378,  43816289,  45128898,  46440170,
+    47750068,  49058555,  50365596,  51671154,  52975195,  54277683,
+    55578583,  56877861,  58175481,  59471410,  60765613,  62058058,
+    63348711,  64637539,  65924509,  67209589,  68492746,  69773950,
+    71053168,  72330369,  73605523,  74878598,  76149566,  77418396,
+    78685058,  79949523,  81211763,  82471750,  83729454,  84984848,
+    86237905,  87488598,  88736900,  89982784,  91226225,  92467197,
+    93705675,  94941633,  96175048,  97405895,  98634150,  99859790,
+    101082791, 102303132, 103520789, 104735741, 105947966, 107157444,
+    108364152, 109568070, 110769179, 111967459, 113162890, 114355454,
+    115545131, 116731904, 117915754, 119096664, 120274618, 121449597,
+    122621586, 123790569, 124956529, 126119453, 127279323, 128436127,
+    129589850, 130740478, 131887997, 133032394, 134173656, 135311772,
+    136446728, 137578513, 138707115, 139832524, 140954729, 142073718,
+    143189483, 144302013, 145411299, 146517332, 147620103, 148719604,
+    149815826, 150908761, 151998403, 153084744, 154167777, 155247495,
+    156323893, 157396964, 158466703, 159533104, 160596162, 161655873,
+    162712231, 163765234, 164814876, 165861155, 166904066, 167943607,
+    168979775, 170012567, 171041981, 172068015, 173090668, 174109937,
+    175125821, 176138320, 177147433, 178153158, 179155496, 180154447,
+    181150011, 182142188, 183130978, 184116384, 185098405, 186077043,
+    187052299, 188024176, 188992675, 189957798, 190919547, 191877926,
+    192832936, 193784581, 194732864, 195677787, 196619355, 197557571,
+    198492438, 199423962, 200352145, 201276993, 202198510, 203116699,
+    204031567, 204943118, 205851358, 206756291, 207657923, 208556259,
+    209451305, 210343068, 211231552, 212116764, 212998711, 213877398,
+    214752832, 215625021, 216493969, 217359685, 218222175, 219081446,
+    219937506, 220790362, 221640021, 222486491, 223329778, 224169892,
+    225006840, 225840629, 226671268, 227498765, 228323127, 229144364,
+    229962483, 230777493, 231589402, 232398219, 233203952, 234006610,
+    234806203, 235602738, 236396225, 237186672, 237974089, 238758485,
+    239539868, 240318249, 241093636, 241866038, 242635466, 243401927,
+    244165433, 244925992, 245683613, 246438307, 247190084, 247938951,
+    248684921, 249428001, 250168202, 250905534, 251640006, 252371629,
+    253100412, 253826365, 254549498, 255269821, 255987345, 256702078,
+    257414031, 258123215, 258829639, 259533313, 260234247, 260932452,
+    261627937, 262320713, 263010790, 263698178, 264382887, 265064928,
+    265744310, 266421043, 267095139, 267766606, 268435456
+};
+
+/**
+ * @brief atan(i / 256) in radians
+ */
+const float32_t atanTable_f32[FAST_MATH_ATAN_TABLE_SIZE + 1] = {
+    0.00000000f, 0.00390623f, 0.00781234f, 0.01171821f, 0.01562373f, 0.01952877f,
+    0.02343321f, 0.02733694f, 0.03123983f, 0.03514178f, 0.03904265f, 0.04294233f,
+    0.04684071f, 0.05073767f, 0.05463308f, 0.05852683f, 0.06241881f, 0.06630889f,
+    0.07019697f, 0.07408292f, 0.07796663f, 0.08184799f, 0.08572688f, 0.08960318f,
+    0.09347678f, 0.09734757f, 0.10121544f, 0.10508027f, 0.10894196f, 0.11280038f,
+    0.11665544f, 0.12050701f, 0.12435499f, 0.12819928f, 0.13203976f, 0.13587633f,
+    0.13970887f, 0.14353729f, 0.14736148f, 0.15118133f, 0.15499674f, 0.15880761f,
+    0.16261383f, 0.16641530f, 0.17021193f, 0.17400360f, 0.17779023f, 0.18157171f,
+    0.18534795f, 0.18911885f, 0.19288431f, 0.19664425f, 0.20039855f, 0.20414715f,
+    0.20788993f, 0.21162681f, 0.21535770f, 0.21908251f, 0.22280115f, 0.22651354f,
+    0.23021959f, 0.23391921f, 0.23761231f, 0.24129883f, 0.24497866f, 0.24865174f,
+    0.25231798f, 0.25597730f, 0.25962963f, 0.26327488f, 0.26691299f, 0.27054387f,
+    0.27416745f, 0.27778366f, 0.28139243f, 0.28499369f, 0.28858736f, 0.29217338f,
+    0.29575169f, 0.29932220f, 0.30288487f, 0.30643962f, 0.30998639f, 0.31352512f,
+    0.31705575f, 0.32057822f, 0.32409247f, 0.32759844f, 0.33109608f, 0.33458532f,
+    0.33806612f, 0.34153843f, 0.34500218f, 0.34845733f, 0.35190383f, 0.35534162f,
+    0.35877067f, 0.36219092f, 0.36560233f, 0.36900485f, 0.37239845f, 0.37578307f,
+    0.37915867f, 0.38252522f, 0.38588267f, 0.38923099f, 0.39257014f, 0.39590007f,
+    0.39922077f, 0.40253219f, 0.40583429f, 0.40912706f, 0.41241044f, 0.41568442f,
+    0.41894897f, 0.42220405f, 0.42544964f, 0.42868571f, 0.43191224f, 0.43512919f,
+    0.43833656f, 0.44153431f, 0.44472242f, 0.44790088f, 0.45106966f, 0.45422874f,
+    0.45737810f, 0.46051773f, 0.46364761f, 0.46676772f, 0.46987806f, 0.47297860f,
+    0.47606933f, 0.47915024f, 0.48222132f, 0.48528256f, 0.48833395f, 0.49137548f,
+    0.49440714f, 0.49742892f, 0.50044081f, 0.50344282f, 0.50643493f, 0.50941715f,
+    0.51238946f, 0.51535187f, 0.51830436f, 0.52124695f, 0.52417963f, 0.52710240f,
+    0.53001525f, 0.53291820f, 0.53581124f, 0.53869437f, 0.54156761f, 0.54443094f,
+    0.54728438f, 0.55012793f, 0.55296160f, 0.55578539f, 0.55859932f, 0.56140337f,
+    0.56419758f, 0.56698193f, 0.56975645f, 0.57252114f, 0.57527602f, 0.57802108f,
+    0.58075635f, 0.58348184f, 0.58619755f, 0.58890350f, 0.59159971f, 0.59428618f,
+    0.59696294f, 0.59962999f, 0.60228735f, 0.60493503f, 0.60757306f, 0.61020144f,
+    0.61282020f, 0.61542935f, 0.61802891f, 0.62061890f, 0.62319933f, 0.62577022f,
+    0.62833160f, 0.63088348f, 0.63342588f, 0.63595883f, 0.63848233f, 0.64099642f,
+    0.64350111f, 0.64599642f, 0.64848239f, 0.65095902f, 0.65342634f, 0.65588438f,
+    0.65833315f, 0.66077268f, 0.66320299f, 0.66562411f, 0.66803606f, 0.67043887f,
+    0.67283255f, 0.67521713f, 0.67759265f, 0.67995911f, 0.68231655f, 0.68466500f,
+    0.68700448f, 0.68933501f, 0.69165662f, 0.69396934f, 0.69627319f, 0.69856821f,
+    0.70085441f, 0.70313182f, 0.70540048f, 0.70766040f, 0.70991162f, 0.71215416f,
+    0.71438805f, 0.71661332f, 0.71883000f, 0.72103811f, 0.72323768f, 0.72542875f,
+    0.72761133f, 0.72978546f, 0.73195117f, 0.73410848f, 0.73625743f, 0.73839804f,
+    0.74053034f, 0.74265436f, 0.74477013f, 0.74687767f, 0.74897703f, 0.75106822f,
+    0.75315128f, 0.75522624f, 0.75729312f, 0.75935195f, 0.76140277f, 0.76344560f,
+    0.76548048f, 0.76750743f, 0.76952648f, 0.77153766f, 0.77354101f, 0.77553655f,
+    0.77752431f, 0.77950432f, 0.78147661f, 0.78344122f, 0.78539816f
+};
+
+/**
+ * @brief tanh(i / 16) in Q1.31
+ */
+const int32_t tanhTable_q32[FAST_MATH_TANH_TABLE_SIZE + 1] = {
+    0,          134043238,  267046038,  398000016,  525958823,  650064194,
+    769566653,  883839965,  992389039,  1094851532, 1190993835, 1280702458,
+    1363971989, 1440890820, 1511625774, 1576406585, 1635510996, 1689251036,
+    1737960815, 1781986033, 1821675246, 1857372819, 1889413451, 1918118093,
+    1943791074, 1966718233, 1987165888, 2005380453, 2021588576, 2035997648,
+    2048796596, 2060156855, 2070233464, 2079166216, 2087080830, 2094090114,
+    2100295089, 2105786059, 2110643629, 2114939645, 2118738072, 2122095801,
+    2125063379, 2127685686, 2130002540, 2132049242, 2133857079, 2135453758,
+    2136863812, 2138108952, 2139208386, 2140179101, 2141036119, 2141792720,
+    2142460640, 2143050249, 2143570713, 2144030125, 2144435637, 2144793563,
+    2145109482, 2145388318, 2145634419, 2145851627, 2146043330, 2146212522,
+    2146361844, 2146493629, 2146609936, 2146712581, 2146803170, 2146883117,
+    2146953672, 2147015939, 2147070891, 2147119387, 2147162186, 2147199956,
+    2147233289, 2147262705, 2147288666, 2147311576, 2147331794, 2147349637,
+    2147365383, 2147379279, 2147391543, 2147402365, 2147411916, 2147420345,
+    2147427783, 2147434347, 2147440140, 2147445252, 2147449764, 2147453745,
+    2147457259, 2147460360, 2147463096, 2147465511, 2147467642, 2147469523,
+    2147471183, 2147472647, 2147473940, 2147475081, 2147476087, 2147476976,
+    2147477760, 2147478452, 2147479062, 2147479601, 2147480077, 2147480496,
+    2147480867, 2147481193, 2147481482, 2147481736, 2147481961, 2147482159,
+    2147482334, 2147482489, 2147482625, 2147482745, 2147482851, 2147482945,
+    2147483027, 2147483100, 2147483165
+};
+
+/**
+ * @brief tanh(i / 16)
  */
-const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1] = {
-    0,      402,    804,    1206,   1608,   2009,   2411,   2811,   3212,   3612,   4011,   4410,
-    4808,   5205,   5602,   5998,   6393,   6787,   7180,   7571,   7962,   8351,   8740,   9127,
-    9512,   9896,   10279,  10660,  11039,  11417,  11793,  12167,  12540,  12910,  13279,  13646,
-    14010,  14373,  14733,  15091,  15447,  15800,  16151,  16500,  16846,  17190,  17531,  17869,
-    18205,  18538,  18868,  19195,  19520,  19841,  20160,  20475,  20788,  21097,  21403,  21706,
-    22006,  22302,  22595,  22884,  23170,  23453,  23732,  24008,  24279,  24548,  24812,  25073,
-    25330,  25583,  25833,  26078,  26320,  26557,  26791,  27020,  27246,  27467,  27684,  27897,
-    28106,  28311,  28511,  28707,  28899,  29086,  29269,  29448,  29622,  29792,  29957,  30118,
-    30274,  30425,  30572,  30715,  30853,  30986,  31114,  31238,  31357,  31471,  31581,  31686,
-    31786,  31881,  31972,  32058,  32138,  32214,  32286,  32352,  32413,  32470,  32522,  32568,
-    32610,  32647,  32679,  32706,  32729,  32746,  32758,  32766,  32767,  32766,  32758,  32746,
-    32729,  32706,  32679,  32647,  32610,  32568,  32522,  32470,  32413,  32352,  32286,  32214,
-    32138,  32058,  31972,  31881,  31786,  31686,  31581,  31471,  31357,  31238,  31114,  30986,
-    30853,  30715,  30572,  30425,  30274,  30118,  29957,  29792,  29622,  29448,  29269,  29086,
-    28899,  28707,  28511,  28311,  28106,  27897,  27684,  27467,  27246,  27020,  26791,  26557,
-    26320,  26078,  25833,  25583,  25330,  25073,  24812,  24548,  24279,  24008,  23732,  23453,
-    23170,  22884,  22595,  22302,  22006,  21706,  21403,  21097,  20788,  20475,  20160,  19841,
-    19520,  19195,  18868,  18538,  18205,  17869,  17531,  17190,  16846,  16500,  16151,  15800,
-    15447,  15091,  14733,  14373,  14010,  13646,  13279,  12910,  12540,  12167,  11793,  11417,
-    11039,  10660,  10279,  9896,   9512,   9127,   8740,   8351,   7962,   7571,   7180,   6787,
-    6393,   5998,   5602,   5205,   4808,   4410,   4011,   3612,   3212,   2811,   2411,   2009,
-    1608,   1206,   804,    402,    0,      -402,   -804,   -1206,  -1608,  -2009,  -2411,  -2811,
-    -3212,  -3612,  -4011,  -4410,  -4808,  -5205,  -5602,  -5998,  -6393,  -6787,  -7180,  -7571,
-    -7962,  -8351,  -8740,  -9127,  -9512,  -9896,  -10279, -10660, -11039, -11417, -11793, -12167,
-    -12540, -12910, -13279, -13646, -14010, -14373, -14733, -15091, -15447, -15800, -16151, -16500,
-    -16846, -17190, -17531, -17869, -18205, -18538, -18868, -19195, -19520, -19841, -20160, -20475,
-    -20788, -21097, -21403, -21706, -22006, -22302, -22595, -22884, -23170, -23453, -23732, -24008,
-    -24279, -24548, -24812, -25073, -25330, -25583, -25833, -26078, -26320, -26557, -26791, -27020,
-    -27246, -27467, -27684, -27897, -28106, -28311, -28511, -28707, -28899, -29086, -29269, -29448,
-    -29622, -29792, -29957, -30118, -30274, -30425, -30572, -30715, -30853, -30986, -31114, -31238,
-    -31357, -31471, -31581, -31686, -31786, -31881, -31972, -32058, -32138, -32214, -32286, -32352,
-    -32413, -32470, -32522, -32568, -32610, -32647, -32679, -32706, -32729, -32746, -32758, -32766,
-    -32768, -32766, -32758, -32746, -32729, -32706, -32679, -32647, -32610, -32568, -32522, -32470,
-    -32413, -32352, -32286, -32214, -32138, -32058, -31972, -31881, -31786, -31686, -31581, -31471,
-    -31357, -31238, -31114, -30986, -30853, -30715, -30572, -30425, -30274, -30118, -29957, -29792,
-    -29622, -29448, -29269, -29086, -28899, -28707, -28511, -28311, -28106, -27897, -27684, -27467,
-    -27246, -27020, -26791, -26557, -26320, -26078, -25833, -25583, -25330, -25073, -24812, -24548,
-    -24279, -24008, -23732, -23453, -23170, -22884, -22595, -22302, -22006, -21706, -21403, -21097,
-    -20788, -20475, -20160, -19841, -19520, -19195, -18868, -18538, -18205, -17869, -17531, -17190,
-    -16846, -16500, -16151, -15800, -15447, -15091, -14733, -14373, -14010, -13646, -13279, -12910,
-    -12540, -12167, -11793, -11417, -11039, -10660, -10279, -9896,  -9512,  -9127,  -8740,  -8351,
-    -7962,  -7571,  -7180,  -6787,  -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,
-    -3212,  -2811,  -2411,  -2009,  -1608,  -1206,  -804,   -402,   0
+const float32_t tanhTable_f32[FAST_MATH_TANH_TABLE_SIZE + 1] = {
+    0.00000000f, 0.06241875f, 0.12435300f, 0.18533320f, 0.24491866f, 0.30270973f,
+    0.35835740f, 0.41157006f, 0.46211716f, 0.50982997f, 0.55459972f, 0.59637356f,
+    0.63514895f, 0.67096707f, 0.70390560f, 0.73407152f, 0.76159416f, 0.78661881f,
+    0.80930107f, 0.82980191f, 0.84828364f, 0.86490662f, 0.87982670f, 0.89319334f,
+    0.90514825f, 0.91582454f, 0.92534623f, 0.93382804f, 0.94137554f, 0.94808529f,
+    0.95404526f, 0.95933529f, 0.96402758f, 0.96818722f, 0.97187275f, 0.97513670f,
+    0.97802611f, 0.98058305f, 0.98284503f, 0.98484552f, 0.98661430f, 0.98817786f,
+    0.98955975f, 0.99078086f, 0.99185972f, 0.99281279f, 0.99365463f, 0.99439815f,
+    0.99505475f, 0.99563457f, 0.99614653f, 0.99659856f, 0.99699764f, 0.99734996f,
+    0.99766098f, 0.99793554f, 0.99817790f, 0.99839183f, 0.99858066f, 0.99874733f,
+    0.99889444f, 0.99902429f, 0.99913889f, 0.99924003f, 0.99932930f, 0.99940809f,
+    0.99947762f, 0.99953899f, 0.99959315f, 0.99964094f, 0.99968313f, 0.99972036f,
+    0.99975321f, 0.99978221f, 0.99980780f, 0.99983038f, 0.99985031f, 0.99986790f,
+    0.99988342f, 0.99989712f, 0.99990920f, 0.99991987f, 0.99992929f, 0.99993760f,
+    0.99994493f, 0.99995140f, 0.99995711f, 0.99996215f, 0.99996660f, 0.99997052f,
+    0.99997399f, 0.99997704f, 0.99997974f, 0.99998212f, 0.99998422f, 0.99998608f,
+    0.99998771f, 0.99998916f, 0.99999043f, 0.99999155f, 0.99999255f, 0.99999342f,
+    0.99999420f, 0.99999488f, 0.99999548f, 0.99999601f, 0.99999648f, 0.99999689f,
+    0.99999726f, 0.99999758f, 0.99999786f, 0.99999812f, 0.99999834f, 0.99999853f,
+    0.99999870f, 0.99999886f, 0.99999899f, 0.99999911f, 0.99999921f, 0.99999931f,
+    0.99999939f, 0.99999946f, 0.99999952f, 0.99999958f, 0.99999963f, 0.99999967f,
+    0.99999971f, 0.99999974f, 0.99999977f
 };
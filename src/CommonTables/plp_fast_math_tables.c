@@ -0,0 +1,319 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fast_math_tables.c
+ * Description:  Sine tables of the fast math functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Generated by src/CommonTables/gen_fast_math_tables.py for 512 table intervals per period.
+ * Do not edit, change PLP_FAST_MATH_TABLE_BITS or PLP_FAST_MATH_QUARTER_WAVE in plp_math.h and
+ * rebuild the library instead.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+#if PLP_FAST_MATH_TABLE_BITS != 9 || defined(PLP_FAST_MATH_QUARTER_WAVE)
+#error "plp_fast_math_tables.c does not match the configuration in plp_math.h, rebuild with make"
+#endif
+
+/**
+  @par
+  sin(2 * PI * n / 512) for n = 0 .. 512
+ */
+const float32_t sinTable_f32[FAST_MATH_SIN_TABLE_LENGTH] = {
+    0.00000000f,  0.01227154f,  0.02454123f,  0.03680722f,  0.04906767f,  0.06132074f,
+    0.07356456f,  0.08579731f,  0.09801714f,  0.11022221f,  0.12241068f,  0.13458071f,
+    0.14673047f,  0.15885814f,  0.17096189f,  0.18303989f,  0.19509032f,  0.20711138f,
+    0.21910124f,  0.23105811f,  0.24298018f,  0.25486566f,  0.26671276f,  0.27851969f,
+    0.29028468f,  0.30200595f,  0.31368174f,  0.32531029f,  0.33688985f,  0.34841868f,
+    0.35989504f,  0.37131719f,  0.38268343f,  0.39399204f,  0.40524131f,  0.41642956f,
+    0.42755509f,  0.43861624f,  0.44961133f,  0.46053871f,  0.47139674f,  0.48218377f,
+    0.49289819f,  0.50353838f,  0.51410274f,  0.52458968f,  0.53499762f,  0.54532499f,
+    0.55557023f,  0.56573181f,  0.57580819f,  0.58579786f,  0.59569930f,  0.60551104f,
+    0.61523159f,  0.62485949f,  0.63439328f,  0.64383154f,  0.65317284f,  0.66241578f,
+    0.67155895f,  0.68060100f,  0.68954054f,  0.69837625f,  0.70710678f,  0.71573083f,
+    0.72424708f,  0.73265427f,  0.74095113f,  0.74913639f,  0.75720885f,  0.76516727f,
+    0.77301045f,  0.78073723f,  0.78834643f,  0.79583690f,  0.80320753f,  0.81045720f,
+    0.81758481f,  0.82458930f,  0.83146961f,  0.83822471f,  0.84485357f,  0.85135519f,
+    0.85772861f,  0.86397286f,  0.87008699f,  0.87607009f,  0.88192126f,  0.88763962f,
+    0.89322430f,  0.89867447f,  0.90398929f,  0.90916798f,  0.91420976f,  0.91911385f,
+    0.92387953f,  0.92850608f,  0.93299280f,  0.93733901f,  0.94154407f,  0.94560733f,
+    0.94952818f,  0.95330604f,  0.95694034f,  0.96043052f,  0.96377607f,  0.96697647f,
+    0.97003125f,  0.97293995f,  0.97570213f,  0.97831737f,  0.98078528f,  0.98310549f,
+    0.98527764f,  0.98730142f,  0.98917651f,  0.99090264f,  0.99247953f,  0.99390697f,
+    0.99518473f,  0.99631261f,  0.99729046f,  0.99811811f,  0.99879546f,  0.99932238f,
+    0.99969882f,  0.99992470f,  1.00000000f,  0.99992470f,  0.99969882f,  0.99932238f,
+    0.99879546f,  0.99811811f,  0.99729046f,  0.99631261f,  0.99518473f,  0.99390697f,
+    0.99247953f,  0.99090264f,  0.98917651f,  0.98730142f,  0.98527764f,  0.98310549f,
+    0.98078528f,  0.97831737f,  0.97570213f,  0.97293995f,  0.97003125f,  0.96697647f,
+    0.96377607f,  0.96043052f,  0.95694034f,  0.95330604f,  0.94952818f,  0.94560733f,
+    0.94154407f,  0.93733901f,  0.93299280f,  0.92850608f,  0.92387953f,  0.91911385f,
+    0.91420976f,  0.90916798f,  0.90398929f,  0.89867447f,  0.89322430f,  0.88763962f,
+    0.88192126f,  0.87607009f,  0.87008699f,  0.86397286f,  0.85772861f,  0.85135519f,
+    0.84485357f,  0.83822471f,  0.83146961f,  0.82458930f,  0.81758481f,  0.81045720f,
+    0.80320753f,  0.79583690f,  0.78834643f,  0.78073723f,  0.77301045f,  0.76516727f,
+    0.75720885f,  0.74913639f,  0.74095113f,  0.73265427f,  0.72424708f,  0.71573083f,
+    0.70710678f,  0.69837625f,  0.68954054f,  0.68060100f,  0.67155895f,  0.66241578f,
+    0.65317284f,  0.64383154f,  0.63439328f,  0.62485949f,  0.61523159f,  0.60551104f,
+    0.59569930f,  0.58579786f,  0.57580819f,  0.56573181f,  0.55557023f,  0.54532499f,
+    0.53499762f,  0.52458968f,  0.51410274f,  0.50353838f,  0.49289819f,  0.48218377f,
+    0.47139674f,  0.46053871f,  0.44961133f,  0.43861624f,  0.42755509f,  0.41642956f,
+    0.40524131f,  0.39399204f,  0.38268343f,  0.37131719f,  0.35989504f,  0.34841868f,
+    0.33688985f,  0.32531029f,  0.31368174f,  0.30200595f,  0.29028468f,  0.27851969f,
+    0.26671276f,  0.25486566f,  0.24298018f,  0.23105811f,  0.21910124f,  0.20711138f,
+    0.19509032f,  0.18303989f,  0.17096189f,  0.15885814f,  0.14673047f,  0.13458071f,
+    0.12241068f,  0.11022221f,  0.09801714f,  0.08579731f,  0.07356456f,  0.06132074f,
+    0.04906767f,  0.03680722f,  0.02454123f,  0.01227154f,  0.00000000f,  -0.01227154f,
+    -0.02454123f, -0.03680722f, -0.04906767f, -0.06132074f, -0.07356456f, -0.08579731f,
+    -0.09801714f, -0.11022221f, -0.12241068f, -0.13458071f, -0.14673047f, -0.15885814f,
+    -0.17096189f, -0.18303989f, -0.19509032f, -0.20711138f, -0.21910124f, -0.23105811f,
+    -0.24298018f, -0.25486566f, -0.26671276f, -0.27851969f, -0.29028468f, -0.30200595f,
+    -0.31368174f, -0.32531029f, -0.33688985f, -0.34841868f, -0.35989504f, -0.37131719f,
+    -0.38268343f, -0.39399204f, -0.40524131f, -0.41642956f, -0.42755509f, -0.43861624f,
+    -0.44961133f, -0.46053871f, -0.47139674f, -0.48218377f, -0.49289819f, -0.50353838f,
+    -0.51410274f, -0.52458968f, -0.53499762f, -0.54532499f, -0.55557023f, -0.56573181f,
+    -0.57580819f, -0.58579786f, -0.59569930f, -0.60551104f, -0.61523159f, -0.62485949f,
+    -0.63439328f, -0.64383154f, -0.65317284f, -0.66241578f, -0.67155895f, -0.68060100f,
+    -0.68954054f, -0.69837625f, -0.70710678f, -0.71573083f, -0.72424708f, -0.73265427f,
+    -0.74095113f, -0.74913639f, -0.75720885f, -0.76516727f, -0.77301045f, -0.78073723f,
+    -0.78834643f, -0.79583690f, -0.80320753f, -0.81045720f, -0.81758481f, -0.82458930f,
+    -0.83146961f, -0.83822471f, -0.84485357f, -0.85135519f, -0.85772861f, -0.86397286f,
+    -0.87008699f, -0.87607009f, -0.88192126f, -0.88763962f, -0.89322430f, -0.89867447f,
+    -0.90398929f, -0.90916798f, -0.91420976f, -0.91911385f, -0.92387953f, -0.92850608f,
+    -0.93299280f, -0.93733901f, -0.94154407f, -0.94560733f, -0.94952818f, -0.95330604f,
+    -0.95694034f, -0.96043052f, -0.96377607f, -0.96697647f, -0.97003125f, -0.97293995f,
+    -0.97570213f, -0.97831737f, -0.98078528f, -0.98310549f, -0.98527764f, -0.98730142f,
+    -0.98917651f, -0.99090264f, -0.99247953f, -0.99390697f, -0.99518473f, -0.99631261f,
+    -0.99729046f, -0.99811811f, -0.99879546f, -0.99932238f, -0.99969882f, -0.99992470f,
+    -1.00000000f, -0.99992470f, -0.99969882f, -0.99932238f, -0.99879546f, -0.99811811f,
+    -0.99729046f, -0.99631261f, -0.99518473f, -0.99390697f, -0.99247953f, -0.99090264f,
+    -0.98917651f, -0.98730142f, -0.98527764f, -0.98310549f, -0.98078528f, -0.97831737f,
+    -0.97570213f, -0.97293995f, -0.97003125f, -0.96697647f, -0.96377607f, -0.96043052f,
+    -0.95694034f, -0.95330604f, -0.94952818f, -0.94560733f, -0.94154407f, -0.93733901f,
+    -0.93299280f, -0.92850608f, -0.92387953f, -0.91911385f, -0.91420976f, -0.90916798f,
+    -0.90398929f, -0.89867447f, -0.89322430f, -0.88763962f, -0.88192126f, -0.87607009f,
+    -0.87008699f, -0.86397286f, -0.85772861f, -0.85135519f, -0.84485357f, -0.83822471f,
+    -0.83146961f, -0.82458930f, -0.81758481f, -0.81045720f, -0.80320753f, -0.79583690f,
+    -0.78834643f, -0.78073723f, -0.77301045f, -0.76516727f, -0.75720885f, -0.74913639f,
+    -0.74095113f, -0.73265427f, -0.72424708f, -0.71573083f, -0.70710678f, -0.69837625f,
+    -0.68954054f, -0.68060100f, -0.67155895f, -0.66241578f, -0.65317284f, -0.64383154f,
+    -0.63439328f, -0.62485949f, -0.61523159f, -0.60551104f, -0.59569930f, -0.58579786f,
+    -0.57580819f, -0.56573181f, -0.55557023f, -0.54532499f, -0.53499762f, -0.52458968f,
+    -0.51410274f, -0.50353838f, -0.49289819f, -0.48218377f, -0.47139674f, -0.46053871f,
+    -0.44961133f, -0.43861624f, -0.42755509f, -0.41642956f, -0.40524131f, -0.39399204f,
+    -0.38268343f, -0.37131719f, -0.35989504f, -0.34841868f, -0.33688985f, -0.32531029f,
+    -0.31368174f, -0.30200595f, -0.29028468f, -0.27851969f, -0.26671276f, -0.25486566f,
+    -0.24298018f, -0.23105811f, -0.21910124f, -0.20711138f, -0.19509032f, -0.18303989f,
+    -0.17096189f, -0.15885814f, -0.14673047f, -0.13458071f, -0.12241068f, -0.11022221f,
+    -0.09801714f, -0.08579731f, -0.07356456f, -0.06132074f, -0.04906767f, -0.03680722f,
+    -0.02454123f, -0.01227154f, -0.00000000f
+};
+
+/**
+  @par
+  sin(2 * PI * n / 512) for n = 0 .. 512 in Q1.31, rounded to nearest and saturated
+ */
+const int32_t sinTable_q32[FAST_MATH_SIN_TABLE_LENGTH] = {
+    0,                   26352928,            52701887,            79042909,
+    105372028,           131685278,           157978697,           184248325,
+    210490206,           236700388,           262874923,           289009871,
+    315101295,           341145265,           367137861,           393075166,
+    418953276,           444768294,           470516330,           496193509,
+    521795963,           547319836,           572761285,           598116479,
+    623381598,           648552838,           673626408,           698598533,
+    723465451,           748223418,           772868706,           797397602,
+    821806413,           846091463,           870249095,           894275671,
+    918167572,           941921200,           965532978,           988999351,
+    1012316784,          1035481766,          1058490808,          1081340445,
+    1104027237,          1126547765,          1148898640,          1171076495,
+    1193077991,          1214899813,          1236538675,          1257991320,
+    1279254516,          1300325060,          1321199781,          1341875533,
+    1362349204,          1382617710,          1402678000,          1422527051,
+    1442161874,          1461579514,          1480777044,          1499751576,
+    1518500250,          1537020244,          1555308768,          1573363068,
+    1591180426,          1608758157,          1626093616,          1643184191,
+    1660027308,          1676620432,          1692961062,          1709046739,
+    1724875040,          1740443581,          1755750017,          1770792044,
+    1785567396,          1800073849,          1814309216,          1828271356,
+    1841958164,          1855367581,          1868497586,          1881346202,
+    1893911494,          1906191570,          1918184581,          1929888720,
+    1941302225,          1952423377,          1963250501,          1973781967,
+    1984016189,          1993951625,          2003586779,          2012920201,
+    2021950484,          2030676269,          2039096241,          2047209133,
+    2055013723,          2062508835,          2069693342,          2076566160,
+    2083126254,          2089372638,          2095304370,          2100920556,
+    2106220352,          2111202959,          2115867626,          2120213651,
+    2124240380,          2127947206,          2131333572,          2134398966,
+    2137142927,          2139565043,          2141664948,          2143442326,
+    2144896910,          2146028480,          2146836866,          2147321946,
+    2147483647,          2147321946,          2146836866,          2146028480,
+    2144896910,          2143442326,          2141664948,          2139565043,
+    2137142927,          2134398966,          2131333572,          2127947206,
+    2124240380,          2120213651,          2115867626,          2111202959,
+    2106220352,          2100920556,          2095304370,          2089372638,
+    2083126254,          2076566160,          2069693342,          2062508835,
+    2055013723,          2047209133,          2039096241,          2030676269,
+    2021950484,          2012920201,          2003586779,          1993951625,
+    1984016189,          1973781967,          1963250501,          1952423377,
+    1941302225,          1929888720,          1918184581,          1906191570,
+    1893911494,          1881346202,          1868497586,          1855367581,
+    1841958164,          1828271356,          1814309216,          1800073849,
+    1785567396,          1770792044,          1755750017,          1740443581,
+    1724875040,          1709046739,          1692961062,          1676620432,
+    1660027308,          1643184191,          1626093616,          1608758157,
+    1591180426,          1573363068,          1555308768,          1537020244,
+    1518500250,          1499751576,          1480777044,          1461579514,
+    1442161874,          1422527051,          1402678000,          1382617710,
+    1362349204,          1341875533,          1321199781,          1300325060,
+    1279254516,          1257991320,          1236538675,          1214899813,
+    1193077991,          1171076495,          1148898640,          1126547765,
+    1104027237,          1081340445,          1058490808,          1035481766,
+    1012316784,          988999351,           965532978,           941921200,
+    918167572,           894275671,           870249095,           846091463,
+    821806413,           797397602,           772868706,           748223418,
+    723465451,           698598533,           673626408,           648552838,
+    623381598,           598116479,           572761285,           547319836,
+    521795963,           496193509,           470516330,           444768294,
+    418953276,           393075166,           367137861,           341145265,
+    315101295,           289009871,           262874923,           236700388,
+    210490206,           184248325,           157978697,           131685278,
+    105372028,           79042909,            52701887,            26352928,
+    0,                   -26352928,           -52701887,           -79042909,
+    -105372028,          -131685278,          -157978697,          -184248325,
+    -210490206,          -236700388,          -262874923,          -289009871,
+    -315101295,          -341145265,          -367137861,          -393075166,
+    -418953276,          -444768294,          -470516330,          -496193509,
+    -521795963,          -547319836,          -572761285,          -598116479,
+    -623381598,          -648552838,          -673626408,          -698598533,
+    -723465451,          -748223418,          -772868706,          -797397602,
+    -821806413,          -846091463,          -870249095,          -894275671,
+    -918167572,          -941921200,          -965532978,          -988999351,
+    -1012316784,         -1035481766,         -1058490808,         -1081340445,
+    -1104027237,         -1126547765,         -1148898640,         -1171076495,
+    -1193077991,         -1214899813,         -1236538675,         -1257991320,
+    -1279254516,         -1300325060,         -1321199781,         -1341875533,
+    -1362349204,         -1382617710,         -1402678000,         -1422527051,
+    -1442161874,         -1461579514,         -1480777044,         -1499751576,
+    -1518500250,         -1537020244,         -1555308768,         -1573363068,
+    -1591180426,         -1608758157,         -1626093616,         -1643184191,
+    -1660027308,         -1676620432,         -1692961062,         -1709046739,
+    -1724875040,         -1740443581,         -1755750017,         -1770792044,
+    -1785567396,         -1800073849,         -1814309216,         -1828271356,
+    -1841958164,         -1855367581,         -1868497586,         -1881346202,
+    -1893911494,         -1906191570,         -1918184581,         -1929888720,
+    -1941302225,         -1952423377,         -1963250501,         -1973781967,
+    -1984016189,         -1993951625,         -2003586779,         -2012920201,
+    -2021950484,         -2030676269,         -2039096241,         -2047209133,
+    -2055013723,         -2062508835,         -2069693342,         -2076566160,
+    -2083126254,         -2089372638,         -2095304370,         -2100920556,
+    -2106220352,         -2111202959,         -2115867626,         -2120213651,
+    -2124240380,         -2127947206,         -2131333572,         -2134398966,
+    -2137142927,         -2139565043,         -2141664948,         -2143442326,
+    -2144896910,         -2146028480,         -2146836866,         -2147321946,
+    (int32_t)0x80000000, -2147321946,         -2146836866,         -2146028480,
+    -2144896910,         -2143442326,         -2141664948,         -2139565043,
+    -2137142927,         -2134398966,         -2131333572,         -2127947206,
+    -2124240380,         -2120213651,         -2115867626,         -2111202959,
+    -2106220352,         -2100920556,         -2095304370,         -2089372638,
+    -2083126254,         -2076566160,         -2069693342,         -2062508835,
+    -2055013723,         -2047209133,         -2039096241,         -2030676269,
+    -2021950484,         -2012920201,         -2003586779,         -1993951625,
+    -1984016189,         -1973781967,         -1963250501,         -1952423377,
+    -1941302225,         -1929888720,         -1918184581,         -1906191570,
+    -1893911494,         -1881346202,         -1868497586,         -1855367581,
+    -1841958164,         -1828271356,         -1814309216,         -1800073849,
+    -1785567396,         -1770792044,         -1755750017,         -1740443581,
+    -1724875040,         -1709046739,         -1692961062,         -1676620432,
+    -1660027308,         -1643184191,         -1626093616,         -1608758157,
+    -1591180426,         -1573363068,         -1555308768,         -1537020244,
+    -1518500250,         -1499751576,         -1480777044,         -1461579514,
+    -1442161874,         -1422527051,         -1402678000,         -1382617710,
+    -1362349204,         -1341875533,         -1321199781,         -1300325060,
+    -1279254516,         -1257991320,         -1236538675,         -1214899813,
+    -1193077991,         -1171076495,         -1148898640,         -1126547765,
+    -1104027237,         -1081340445,         -1058490808,         -1035481766,
+    -1012316784,         -988999351,          -965532978,          -941921200,
+    -918167572,          -894275671,          -870249095,          -846091463,
+    -821806413,          -797397602,          -772868706,          -748223418,
+    -723465451,          -698598533,          -673626408,          -648552838,
+    -623381598,          -598116479,          -572761285,          -547319836,
+    -521795963,          -496193509,          -470516330,          -444768294,
+    -418953276,          -393075166,          -367137861,          -341145265,
+    -315101295,          -289009871,          -262874923,          -236700388,
+    -210490206,          -184248325,          -157978697,          -131685278,
+    -105372028,          -79042909,           -52701887,           -26352928,
+    0
+};
+
+/**
+  @par
+  sin(2 * PI * n / 512) for n = 0 .. 512 in Q1.15, rounded to nearest and saturated
+ */
+const int16_t sinTable_q16[FAST_MATH_SIN_TABLE_LENGTH] = {
+    0,      402,    804,    1206,   1608,   2009,   2411,   2811,   3212,   3612,   4011,   4410,
+    4808,   5205,   5602,   5998,   6393,   6787,   7180,   7571,   7962,   8351,   8740,   9127,
+    9512,   9896,   10279,  10660,  11039,  11417,  11793,  12167,  12540,  12910,  13279,  13646,
+    14010,  14373,  14733,  15091,  15447,  15800,  16151,  16500,  16846,  17190,  17531,  17869,
+    18205,  18538,  18868,  19195,  19520,  19841,  20160,  20475,  20788,  21097,  21403,  21706,
+    22006,  22302,  22595,  22884,  23170,  23453,  23732,  24008,  24279,  24548,  24812,  25073,
+    25330,  25583,  25833,  26078,  26320,  26557,  26791,  27020,  27246,  27467,  27684,  27897,
+    28106,  28311,  28511,  28707,  28899,  29086,  29269,  29448,  29622,  29792,  29957,  30118,
+    30274,  30425,  30572,  30715,  30853,  30986,  31114,  31238,  31357,  31471,  31581,  31686,
+    31786,  31881,  31972,  32058,  32138,  32214,  32286,  32352,  32413,  32470,  32522,  32568,
+    32610,  32647,  32679,  32706,  32729,  32746,  32758,  32766,  32767,  32766,  32758,  32746,
+    32729,  32706,  32679,  32647,  32610,  32568,  32522,  32470,  32413,  32352,  32286,  32214,
+    32138,  32058,  31972,  31881,  31786,  31686,  31581,  31471,  31357,  31238,  31114,  30986,
+    30853,  30715,  30572,  30425,  30274,  30118,  29957,  29792,  29622,  29448,  29269,  29086,
+    28899,  28707,  28511,  28311,  28106,  27897,  27684,  27467,  27246,  27020,  26791,  26557,
+    26320,  26078,  25833,  25583,  25330,  25073,  24812,  24548,  24279,  24008,  23732,  23453,
+    23170,  22884,  22595,  22302,  22006,  21706,  21403,  21097,  20788,  20475,  20160,  19841,
+    19520,  19195,  18868,  18538,  18205,  17869,  17531,  17190,  16846,  16500,  16151,  15800,
+    15447,  15091,  14733,  14373,  14010,  13646,  13279,  12910,  12540,  12167,  11793,  11417,
+    11039,  10660,  10279,  9896,   9512,   9127,   8740,   8351,   7962,   7571,   7180,   6787,
+    6393,   5998,   5602,   5205,   4808,   4410,   4011,   3612,   3212,   2811,   2411,   2009,
+    1608,   1206,   804,    402,    0,      -402,   -804,   -1206,  -1608,  -2009,  -2411,  -2811,
+    -3212,  -3612,  -4011,  -4410,  -4808,  -5205,  -5602,  -5998,  -6393,  -6787,  -7180,  -7571,
+    -7962,  -8351,  -8740,  -9127,  -9512,  -9896,  -10279, -10660, -11039, -11417, -11793, -12167,
+    -12540, -12910, -13279, -13646, -14010, -14373, -14733, -15091, -15447, -15800, -16151, -16500,
+    -16846, -17190, -17531, -17869, -18205, -18538, -18868, -19195, -19520, -19841, -20160, -20475,
+    -20788, -21097, -21403, -21706, -22006, -22302, -22595, -22884, -23170, -23453, -23732, -24008,
+    -24279, -24548, -24812, -25073, -25330, -25583, -25833, -26078, -26320, -26557, -26791, -27020,
+    -27246, -27467, -27684, -27897, -28106, -28311, -28511, -28707, -28899, -29086, -29269, -29448,
+    -29622, -29792, -29957, -30118, -30274, -30425, -30572, -30715, -30853, -30986, -31114, -31238,
+    -31357, -31471, -31581, -31686, -31786, -31881, -31972, -32058, -32138, -32214, -32286, -32352,
+    -32413, -32470, -32522, -32568, -32610, -32647, -32679, -32706, -32729, -32746, -32758, -32766,
+    -32768, -32766, -32758, -32746, -32729, -32706, -32679, -32647, -32610, -32568, -32522, -32470,
+    -32413, -32352, -32286, -32214, -32138, -32058, -31972, -31881, -31786, -31686, -31581, -31471,
+    -31357, -31238, -31114, -30986, -30853, -30715, -30572, -30425, -30274, -30118, -29957, -29792,
+    -29622, -29448, -29269, -29086, -28899, -28707, -28511, -28311, -28106, -27897, -27684, -27467,
+    -27246, -27020, -26791, -26557, -26320, -26078, -25833, -25583, -25330, -25073, -24812, -24548,
+    -24279, -24008, -23732, -23453, -23170, -22884, -22595, -22302, -22006, -21706, -21403, -21097,
+    -20788, -20475, -20160, -19841, -19520, -19195, -18868, -18538, -18205, -17869, -17531, -17190,
+    -16846, -16500, -16151, -15800, -15447, -15091, -14733, -14373, -14010, -13646, -13279, -12910,
+    -12540, -12167, -11793, -11417, -11039, -10660, -10279, -9896,  -9512,  -9127,  -8740,  -8351,
+    -7962,  -7571,  -7180,  -6787,  -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,
+    -3212,  -2811,  -2411,  -2009,  -1608,  -1206,  -804,   -402,   0
+};
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_deinterleave_i32s_xpulpv2.c
+ * Description:  32-bit complex deinterleave for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxDeinterleave
+  @{
+ */
+
+/**
+  @brief         32-bit complex deinterleave for XPULPV2.
+  @param[in]     pSrc        points to the interleaved input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_deinterleave_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                         int32_t *__restrict__ pDstRe,
+                                         int32_t *__restrict__ pDstIm,
+                                         uint32_t numSamples) {
+
+    uint32_t i;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        pDstRe[i] = pSrc[2 * i];
+        pDstIm[i] = pSrc[2 * i + 1];
+        pDstRe[i + 1] = pSrc[2 * i + 2];
+        pDstIm[i + 1] = pSrc[2 * i + 3];
+    }
+
+    if (numSamples % 2 == 1) {
+        pDstRe[i] = pSrc[2 * i];
+        pDstIm[i] = pSrc[2 * i + 1];
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        pDstRe[i] = pSrc[2 * i];
+        pDstIm[i] = pSrc[2 * i + 1];
+    }
+
+#endif
+}
+
+/**
+  @} end of CmplxDeinterleave group
+ */
@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_batch_f32s_xpulpv2.c
+ * Description:  Floating-point batched complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_batch
+  @{
+ */
+
+/**
+  @brief         Floating-point batched complex dot product for XPULPV2.
+  @param[in]     pSrcA       points to the numVectors complex vectors, stored one after the other
+  @param[in]     pSrcB       points to the complex vector shared by all dot products
+  @param[in]     numVectors  number of vectors in pSrcA
+  @param[in]     numSamples  number of complex samples in each vector
+  @param[out]    pDst        points to the numVectors complex results
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_batch_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                           const float32_t *__restrict__ pSrcB,
+                                           uint32_t numVectors,
+                                           uint32_t numSamples,
+                                           float32_t *__restrict__ pDst) {
+
+    uint32_t i, n;
+    const float32_t *pA0, *pA1, *pA2, *pA3;
+    float32_t a, b, c, d;
+    float32_t re0, im0, re1, im1, re2, im2, re3, im3;
+
+    /* four vectors per pass share the loads of pSrcB */
+    for (n = 0; n < (numVectors & ~3U); n += 4) {
+        pA0 = pSrcA + 2 * numSamples * n;
+        pA1 = pA0 + 2 * numSamples;
+        pA2 = pA1 + 2 * numSamples;
+        pA3 = pA2 + 2 * numSamples;
+        re0 = re1 = re2 = re3 = 0.0f;
+        im0 = im1 = im2 = im3 = 0.0f;
+
+        for (i = 0; i < numSamples; i++) {
+            c = pSrcB[2 * i];
+            d = pSrcB[2 * i + 1];
+            a = pA0[2 * i];
+            b = pA0[2 * i + 1];
+            re0 += (a * c) - (b * d);
+            im0 += (a * d) + (b * c);
+            a = pA1[2 * i];
+            b = pA1[2 * i + 1];
+            re1 += (a * c) - (b * d);
+            im1 += (a * d) + (b * c);
+            a = pA2[2 * i];
+            b = pA2[2 * i + 1];
+            re2 += (a * c) - (b * d);
+            im2 += (a * d) + (b * c);
+            a = pA3[2 * i];
+            b = pA3[2 * i + 1];
+            re3 += (a * c) - (b * d);
+            im3 += (a * d) + (b * c);
+        }
+
+        pDst[2 * n] = re0;
+        pDst[2 * n + 1] = im0;
+        pDst[2 * (n + 1)] = re1;
+        pDst[2 * (n + 1) + 1] = im1;
+        pDst[2 * (n + 2)] = re2;
+        pDst[2 * (n + 2) + 1] = im2;
+        pDst[2 * (n + 3)] = re3;
+        pDst[2 * (n + 3) + 1] = im3;
+    }
+
+    /* remaining vectors one at a time */
+    for (; n < numVectors; n++) {
+        pA0 = pSrcA + 2 * numSamples * n;
+        re0 = 0.0f;
+        im0 = 0.0f;
+
+        for (i = 0; i < numSamples; i++) {
+            c = pSrcB[2 * i];
+            d = pSrcB[2 * i + 1];
+            a = pA0[2 * i];
+            b = pA0[2 * i + 1];
+            re0 += (a * c) - (b * d);
+            im0 += (a * d) + (b * c);
+        }
+
+        pDst[2 * n] = re0;
+        pDst[2 * n + 1] = im0;
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod_batch group
+ */
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_batch_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point batched complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_batch
+  @{
+ */
+
+/**
+  @brief         Parallel 16-bit fixed-point batched complex dot product kernel for XPULPV2
+                 extension.
+  @param[in]     task_args  pointer to plp_cmplx_dot_prod_batch_instance_q16 struct initialized by
+                            plp_cmplx_dot_prod_batch_q16_parallel
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_batch_q16p_xpulpv2(void *task_args) {
+
+    plp_cmplx_dot_prod_batch_instance_q16 *S = (plp_cmplx_dot_prod_batch_instance_q16 *)task_args;
+    uint32_t core_id = rt_core_id();
+
+    // contiguous block of whole vectors per core, every core reads all of pSrcB
+    uint32_t numVectors = S->numVectors;
+    uint32_t blkSizePE = (numVectors + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * blkSizePE;
+    uint32_t len = 0;
+
+    if (start < numVectors) {
+        len = (numVectors - start < blkSizePE) ? numVectors - start : blkSizePE;
+    }
+
+    plp_cmplx_dot_prod_batch_q16s_xpulpv2(S->pSrcA + 2 * S->numSamples * start,
+                                          S->pSrcB,
+                                          len,
+                                          S->numSamples,
+                                          S->deciPoint,
+                                          S->pDst + 2 * start);
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of cmplx_dot_prod_batch group
+ */
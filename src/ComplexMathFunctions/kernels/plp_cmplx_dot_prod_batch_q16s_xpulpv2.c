@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_batch_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point batched complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_batch
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point batched complex dot product for XPULPV2.
+  @param[in]     pSrcA       points to the numVectors complex vectors, stored one after the other
+  @param[in]     pSrcB       points to the complex vector shared by all dot products
+  @param[in]     numVectors  number of vectors in pSrcA
+  @param[in]     numSamples  number of complex samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    pDst        points to the numVectors complex results
+  @return        none
+  @par
+  Every complex sample is processed as one packed word, hence all vectors must be aligned to
+  4 bytes. The sign of the imaginary part of pSrcB is flipped inside the packed operand as in
+  plp_cmplx_mac_q16, after an imaginary part of -32768 has been clipped to -32767.
+ */
+
+void plp_cmplx_dot_prod_batch_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t numVectors,
+                                           uint32_t numSamples,
+                                           uint32_t deciPoint,
+                                           int16_t *__restrict__ pDst) {
+
+    uint32_t i, n;
+    const int16_t *pA0, *pA1, *pA2, *pA3;
+    v2s a, b, bRe, bIm;
+    const v2s bMin = (v2s){ -32768, -32767 }; // keeps -b[1] in 16 bits
+    int32_t re0, im0, re1, im1, re2, im2, re3, im3;
+
+    /* four vectors per pass share the loads of pSrcB */
+    for (n = 0; n < (numVectors & ~3U); n += 4) {
+        pA0 = pSrcA + 2 * numSamples * n;
+        pA1 = pA0 + 2 * numSamples;
+        pA2 = pA1 + 2 * numSamples;
+        pA3 = pA2 + 2 * numSamples;
+        re0 = re1 = re2 = re3 = 0;
+        im0 = im1 = im2 = im3 = 0;
+
+        for (i = 0; i < numSamples; i++) {
+            b = *(v2s *)&pSrcB[2 * i];
+            bRe = __PACK2(b[0], -__MAX2(b, bMin)[1]);
+            bIm = __PACK2(b[1], b[0]);
+            a = *(v2s *)&pA0[2 * i];
+            re0 = __SUMDOTP2(a, bRe, re0);
+            im0 = __SUMDOTP2(a, bIm, im0);
+            a = *(v2s *)&pA1[2 * i];
+            re1 = __SUMDOTP2(a, bRe, re1);
+            im1 = __SUMDOTP2(a, bIm, im1);
+            a = *(v2s *)&pA2[2 * i];
+            re2 = __SUMDOTP2(a, bRe, re2);
+            im2 = __SUMDOTP2(a, bIm, im2);
+            a = *(v2s *)&pA3[2 * i];
+            re3 = __SUMDOTP2(a, bRe, re3);
+            im3 = __SUMDOTP2(a, bIm, im3);
+        }
+
+        pDst[2 * n] = __ROUNDNORM_REG(re0, deciPoint);
+        pDst[2 * n + 1] = __ROUNDNORM_REG(im0, deciPoint);
+        pDst[2 * (n + 1)] = __ROUNDNORM_REG(re1, deciPoint);
+        pDst[2 * (n + 1) + 1] = __ROUNDNORM_REG(im1, deciPoint);
+        pDst[2 * (n + 2)] = __ROUNDNORM_REG(re2, deciPoint);
+        pDst[2 * (n + 2) + 1] = __ROUNDNORM_REG(im2, deciPoint);
+        pDst[2 * (n + 3)] = __ROUNDNORM_REG(re3, deciPoint);
+        pDst[2 * (n + 3) + 1] = __ROUNDNORM_REG(im3, deciPoint);
+    }
+
+    /* remaining vectors one at a time */
+    for (; n < numVectors; n++) {
+        pA0 = pSrcA + 2 * numSamples * n;
+        re0 = 0;
+        im0 = 0;
+
+        for (i = 0; i < numSamples; i++) {
+            b = *(v2s *)&pSrcB[2 * i];
+            bRe = __PACK2(b[0], -__MAX2(b, bMin)[1]);
+            bIm = __PACK2(b[1], b[0]);
+            a = *(v2s *)&pA0[2 * i];
+            re0 = __SUMDOTP2(a, bRe, re0);
+            im0 = __SUMDOTP2(a, bIm, im0);
+        }
+
+        pDst[2 * n] = __ROUNDNORM_REG(re0, deciPoint);
+        pDst[2 * n + 1] = __ROUNDNORM_REG(im0, deciPoint);
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod_batch group
+ */
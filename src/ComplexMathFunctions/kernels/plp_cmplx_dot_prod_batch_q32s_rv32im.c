@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_batch_q32s_rv32im.c
+ * Description:  32-bit fixed-point batched complex dot product for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_batch
+  @{
+ */
+
+/**
+  @brief         32-bit fixed-point batched complex dot product for RV32IM.
+  @param[in]     pSrcA       points to the numVectors complex vectors, stored one after the other
+  @param[in]     pSrcB       points to the complex vector shared by all dot products
+  @param[in]     numVectors  number of vectors in pSrcA
+  @param[in]     numSamples  number of complex samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    pDst        points to the numVectors complex results
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_batch_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t numVectors,
+                                          uint32_t numSamples,
+                                          uint32_t deciPoint,
+                                          int32_t *__restrict__ pDst) {
+
+    uint32_t i, n;
+    const int32_t *pA0, *pA1;
+    int32_t a, b, c, d;
+    int64_t re0, im0, re1, im1;
+    int64_t rnd = ((int64_t)1 << deciPoint) >> 1; // round to nearest
+
+    /* two vectors per pass share the loads of pSrcB */
+    for (n = 0; n < (numVectors & ~1U); n += 2) {
+        pA0 = pSrcA + 2 * numSamples * n;
+        pA1 = pA0 + 2 * numSamples;
+        re0 = re1 = 0;
+        im0 = im1 = 0;
+
+        for (i = 0; i < numSamples; i++) {
+            c = pSrcB[2 * i];
+            d = pSrcB[2 * i + 1];
+            a = pA0[2 * i];
+            b = pA0[2 * i + 1];
+            re0 += (int64_t)a * c - (int64_t)b * d;
+            im0 += (int64_t)a * d + (int64_t)b * c;
+            a = pA1[2 * i];
+            b = pA1[2 * i + 1];
+            re1 += (int64_t)a * c - (int64_t)b * d;
+            im1 += (int64_t)a * d + (int64_t)b * c;
+        }
+
+        pDst[2 * n] = (re0 + rnd) >> deciPoint;
+        pDst[2 * n + 1] = (im0 + rnd) >> deciPoint;
+        pDst[2 * (n + 1)] = (re1 + rnd) >> deciPoint;
+        pDst[2 * (n + 1) + 1] = (im1 + rnd) >> deciPoint;
+    }
+
+    /* remaining vectors one at a time */
+    for (; n < numVectors; n++) {
+        pA0 = pSrcA + 2 * numSamples * n;
+        re0 = 0;
+        im0 = 0;
+
+        for (i = 0; i < numSamples; i++) {
+            c = pSrcB[2 * i];
+            d = pSrcB[2 * i + 1];
+            a = pA0[2 * i];
+            b = pA0[2 * i + 1];
+            re0 += (int64_t)a * c - (int64_t)b * d;
+            im0 += (int64_t)a * d + (int64_t)b * c;
+        }
+
+        pDst[2 * n] = (re0 + rnd) >> deciPoint;
+        pDst[2 * n + 1] = (im0 + rnd) >> deciPoint;
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod_batch group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_i16p_xpulpv2.c
+ * Description:  Parallel 16-bit integer complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod
+  @{
+ */
+
+/**
+  @brief         Parallel 16-bit integer complex dot product kernel for XPULPV2 extension.
+  @param[in]     task_args  pointer to plp_cmplx_dot_prod_instance_i16 struct initialized by
+                            plp_cmplx_dot_prod_i16_parallel
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_i16p_xpulpv2(void *task_args) {
+
+    plp_cmplx_dot_prod_instance_i16 *S = (plp_cmplx_dot_prod_instance_i16 *)task_args;
+    uint32_t core_id = rt_core_id();
+
+    // partial sums of a contiguous block of whole complex samples per core
+    uint32_t numSamples = S->numSamples;
+    uint32_t blkSizePE = (numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * blkSizePE;
+    uint32_t len = 0;
+
+    if (start < numSamples) {
+        len = (numSamples - start < blkSizePE) ? numSamples - start : blkSizePE;
+    }
+
+    plp_cmplx_dot_prod_i16_xpulpv2(S->pSrcA + 2 * start,
+                                   S->pSrcB + 2 * start,
+                                   len,
+                                   &S->realBuffer[core_id],
+                                   &S->imagBuffer[core_id]);
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of cmplx_dot_prod group
+ */
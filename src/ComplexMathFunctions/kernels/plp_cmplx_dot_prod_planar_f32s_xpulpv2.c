@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_planar_f32s_xpulpv2.c
+ * Description:  Floating-point planar complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_planar
+  @{
+ */
+
+/**
+  @brief         Floating-point planar complex dot product for XPULPV2.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_f32s_xpulpv2(const float32_t *pSrcARe,
+                                            const float32_t *pSrcAIm,
+                                            const float32_t *pSrcBRe,
+                                            const float32_t *pSrcBIm,
+                                            uint32_t numSamples,
+                                            float32_t *realResult,
+                                            float32_t *imagResult) {
+
+    uint32_t i;
+    float32_t a, b, c, d;
+    float32_t real_sum = 0.0f, imag_sum = 0.0f;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        real_sum += (a * c) - (b * d);
+        imag_sum += (a * d) + (b * c);
+        a = pSrcARe[i + 1];
+        b = pSrcAIm[i + 1];
+        c = pSrcBRe[i + 1];
+        d = pSrcBIm[i + 1];
+        real_sum += (a * c) - (b * d);
+        imag_sum += (a * d) + (b * c);
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        real_sum += (a * c) - (b * d);
+        imag_sum += (a * d) + (b * c);
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        real_sum += (a * c) - (b * d);
+        imag_sum += (a * d) + (b * c);
+    }
+
+#endif
+
+    *realResult = real_sum;
+    *imagResult = imag_sum;
+}
+
+/**
+  @} end of cmplx_dot_prod_planar group
+ */
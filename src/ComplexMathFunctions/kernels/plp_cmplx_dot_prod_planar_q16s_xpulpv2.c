@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_planar_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point planar complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_planar
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point planar complex dot product for XPULPV2.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+  @par
+  Two samples are processed per word, hence all vectors must be aligned to 4 bytes.
+ */
+
+void plp_cmplx_dot_prod_planar_q16s_xpulpv2(const int16_t *pSrcARe,
+                                            const int16_t *pSrcAIm,
+                                            const int16_t *pSrcBRe,
+                                            const int16_t *pSrcBIm,
+                                            uint32_t numSamples,
+                                            uint32_t deciPoint,
+                                            int16_t *realResult,
+                                            int16_t *imagResult) {
+
+    uint32_t i;
+    v2s aRe, aIm, bRe, bIm;
+    int16_t a, b, c, d;
+    int32_t real_sum = 0, imag_sum = 0;
+
+    /* the planar layout already holds two samples of the same part in each word */
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        aRe = *(v2s *)&pSrcARe[i];
+        aIm = *(v2s *)&pSrcAIm[i];
+        bRe = *(v2s *)&pSrcBRe[i];
+        bIm = *(v2s *)&pSrcBIm[i];
+
+        real_sum = __SUMDOTP2(aRe, bRe, real_sum);
+        real_sum -= __DOTP2(aIm, bIm);
+        imag_sum = __SUMDOTP2(aRe, bIm, imag_sum);
+        imag_sum = __SUMDOTP2(aIm, bRe, imag_sum);
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        real_sum += a * c - b * d;
+        imag_sum += a * d + b * c;
+    }
+
+    *realResult = __ROUNDNORM_REG(real_sum, deciPoint);
+    *imagResult = __ROUNDNORM_REG(imag_sum, deciPoint);
+}
+
+/**
+  @} end of cmplx_dot_prod_planar group
+ */
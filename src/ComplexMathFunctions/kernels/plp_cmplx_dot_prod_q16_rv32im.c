@@ -87,6 +87,9 @@ void plp_cmplx_dot_prod_q16_rv32im(const int16_t *pSrcA,
     uint32_t blkCnt;                    /* Loop counter */
     int16_t real_sum = 0, imag_sum = 0; /* Temporary result variables */
     int16_t a0, b0, c0, d0;
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int64_t real_acc = 0, imag_acc = 0;
+#endif
     int32_t bias = 1 << (deciPoint - 1);
 
     /* Initialize blkCnt with number of samples */
@@ -97,18 +100,32 @@ void plp_cmplx_dot_prod_q16_rv32im(const int16_t *pSrcA,
         c0 = *pSrcB++;
         d0 = *pSrcB++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* accumulate at full precision in 64 bits, a0 * d0 + b0 * c0 reaches 2^31 */
+        real_acc += a0 * c0 - b0 * d0;
+        imag_acc += (int64_t)(a0 * d0) + b0 * c0;
+#else
         real_sum += ((a0 * c0) + bias) >> deciPoint;
         imag_sum += ((a0 * d0) + bias) >> deciPoint;
         real_sum -= ((b0 * d0) + bias) >> deciPoint;
         imag_sum += ((b0 * c0) + bias) >> deciPoint;
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
     }
 
     /* Store real and imaginary result in destination buffer. */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    /* saturate the sums to the output range */
+    real_acc = (real_acc + ((1 << deciPoint) >> 1)) >> deciPoint;
+    imag_acc = (imag_acc + ((1 << deciPoint) >> 1)) >> deciPoint;
+    *realResult = (real_acc > 0x7FFF) ? 0x7FFF : ((real_acc < -0x8000) ? -0x8000 : real_acc);
+    *imagResult = (imag_acc > 0x7FFF) ? 0x7FFF : ((imag_acc < -0x8000) ? -0x8000 : imag_acc);
+#else
     *realResult = real_sum;
     *imagResult = imag_sum;
+#endif
     // printf("real %d imag %d\n", real_sum, imag_sum);
 }
 /**
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod
+  @{
+ */
+
+/**
+  @brief         Parallel 16-bit fixed-point complex dot product kernel for XPULPV2 extension.
+  @param[in]     task_args  pointer to plp_cmplx_dot_prod_instance_q16 struct initialized by
+                            plp_cmplx_dot_prod_q16_parallel
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q16p_xpulpv2(void *task_args) {
+
+    plp_cmplx_dot_prod_instance_q16 *S = (plp_cmplx_dot_prod_instance_q16 *)task_args;
+    uint32_t core_id = rt_core_id();
+
+    // partial sums of a contiguous block of whole complex samples per core
+    uint32_t numSamples = S->numSamples;
+    uint32_t blkSizePE = (numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * blkSizePE;
+    uint32_t len = 0;
+
+    if (start < numSamples) {
+        len = (numSamples - start < blkSizePE) ? numSamples - start : blkSizePE;
+    }
+
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    // full precision partial sums, the glue code rounds and saturates their total once
+    const int16_t *pA = S->pSrcA + 2 * start;
+    const int16_t *pB = S->pSrcB + 2 * start;
+    int64_t real_acc = 0, imag_acc = 0;
+    int16_t a0, b0, c0, d0;
+
+    while (len > 0U) {
+        a0 = *pA++;
+        b0 = *pA++;
+        c0 = *pB++;
+        d0 = *pB++;
+
+        real_acc += a0 * c0 - b0 * d0;
+        imag_acc += (int64_t)(a0 * d0) + b0 * c0;
+
+        len--;
+    }
+
+    S->realBuffer[core_id] = real_acc;
+    S->imagBuffer[core_id] = imag_acc;
+#else
+    plp_cmplx_dot_prod_q16_xpulpv2(S->pSrcA + 2 * start,
+                                   S->pSrcB + 2 * start,
+                                   len,
+                                   S->deciPoint,
+                                   &S->realBuffer[core_id],
+                                   &S->imagBuffer[core_id]);
+#endif
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of cmplx_dot_prod group
+ */
@@ -87,6 +87,11 @@ void plp_cmplx_dot_prod_q32_rv32im(const int32_t *pSrcA,
     uint32_t blkCnt;                    /* Loop counter */
     int32_t real_sum = 0, imag_sum = 0; /* Temporary result variables */
     int32_t a0, b0, c0, d0;
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int64_t real_acc = 0, imag_acc = 0, re, im, sum;
+    int32_t real_wraps = 0, imag_wraps = 0; // overflows of the 64-bit sums, in units of 2^64
+    int64_t rnd = ((int64_t)1 << deciPoint) >> 1; // round to nearest
+#endif
     int32_t bias = 1 << (deciPoint - 1);
 
     /* Initialize blkCnt with number of samples */
@@ -97,18 +102,45 @@ void plp_cmplx_dot_prod_q32_rv32im(const int32_t *pSrcA,
         c0 = *pSrcB++;
         d0 = *pSrcB++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round every sample once */
+        re = ((int64_t)a0 * c0 - (int64_t)b0 * d0 + rnd) >> deciPoint;
+        /* a0 * d0 + b0 * c0 reaches 2^63 only for (-1 - 1i) * (-1 - 1i), it wraps to INT64_MIN */
+        im = (int64_t)((uint64_t)((int64_t)a0 * d0) + (uint64_t)((int64_t)b0 * c0));
+        im = (im == INT64_MIN) ? (int64_t)((uint64_t)1 << (63 - deciPoint))
+                               : ((im + rnd) >> deciPoint);
+
+        /* accumulate in 64 bits and count the signed overflows, so long sums keep their sign */
+        sum = (int64_t)((uint64_t)real_acc + (uint64_t)re);
+        real_wraps += (((real_acc ^ sum) & (re ^ sum)) < 0) ? ((re < 0) ? -1 : 1) : 0;
+        real_acc = sum;
+        sum = (int64_t)((uint64_t)imag_acc + (uint64_t)im);
+        imag_wraps += (((imag_acc ^ sum) & (im ^ sum)) < 0) ? ((im < 0) ? -1 : 1) : 0;
+        imag_acc = sum;
+#else
         real_sum += ((a0 * c0) + bias) >> deciPoint;
         imag_sum += ((a0 * d0) + bias) >> deciPoint;
         real_sum -= ((b0 * d0) + bias) >> deciPoint;
         imag_sum += ((b0 * c0) + bias) >> deciPoint;
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
     }
 
     /* Store real and imaginary result in destination buffer. */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    /* saturate the sums to the output range, a sum that overflowed is beyond it */
+    real_acc = (real_wraps > 0 || real_acc > 0x7FFFFFFF) ? 0x7FFFFFFF : real_acc;
+    real_acc = (real_wraps < 0 || real_acc < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : real_acc;
+    *realResult = real_acc;
+    imag_acc = (imag_wraps > 0 || imag_acc > 0x7FFFFFFF) ? 0x7FFFFFFF : imag_acc;
+    imag_acc = (imag_wraps < 0 || imag_acc < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : imag_acc;
+    *imagResult = imag_acc;
+#else
     *realResult = real_sum;
     *imagResult = imag_sum;
+#endif
     // printf("real %d imag %d\n", real_sum, imag_sum);
 }
 /**
@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed-point complex dot product for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod
+  @{
+ */
+
+/**
+  @brief         Parallel 32-bit fixed-point complex dot product kernel for XPULPV2 extension.
+  @param[in]     task_args  pointer to plp_cmplx_dot_prod_instance_q32 struct initialized by
+                            plp_cmplx_dot_prod_q32_parallel
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_q32p_xpulpv2(void *task_args) {
+
+    plp_cmplx_dot_prod_instance_q32 *S = (plp_cmplx_dot_prod_instance_q32 *)task_args;
+    uint32_t core_id = rt_core_id();
+
+    // partial sums of a contiguous block of whole complex samples per core
+    uint32_t numSamples = S->numSamples;
+    uint32_t blkSizePE = (numSamples + S->nPE - 1) / S->nPE;
+    uint32_t start = core_id * blkSizePE;
+    uint32_t len = 0;
+
+    if (start < numSamples) {
+        len = (numSamples - start < blkSizePE) ? numSamples - start : blkSizePE;
+    }
+
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    // partial sums of the rounded samples and their overflow counts, the glue code saturates the
+    // total
+    const int32_t *pA = S->pSrcA + 2 * start;
+    const int32_t *pB = S->pSrcB + 2 * start;
+    int64_t rnd = ((int64_t)1 << S->deciPoint) >> 1; // round to nearest
+    int64_t real_acc = 0, imag_acc = 0, re, im, sum;
+    int32_t real_wraps = 0, imag_wraps = 0;
+    int32_t a0, b0, c0, d0;
+
+    while (len > 0U) {
+        a0 = *pA++;
+        b0 = *pA++;
+        c0 = *pB++;
+        d0 = *pB++;
+
+        re = ((int64_t)a0 * c0 - (int64_t)b0 * d0 + rnd) >> S->deciPoint;
+        /* a0 * d0 + b0 * c0 reaches 2^63 only for (-1 - 1i) * (-1 - 1i), it wraps to INT64_MIN */
+        im = (int64_t)((uint64_t)((int64_t)a0 * d0) + (uint64_t)((int64_t)b0 * c0));
+        im = (im == INT64_MIN) ? (int64_t)((uint64_t)1 << (63 - S->deciPoint))
+                               : ((im + rnd) >> S->deciPoint);
+
+        sum = (int64_t)((uint64_t)real_acc + (uint64_t)re);
+        real_wraps += (((real_acc ^ sum) & (re ^ sum)) < 0) ? ((re < 0) ? -1 : 1) : 0;
+        real_acc = sum;
+        sum = (int64_t)((uint64_t)imag_acc + (uint64_t)im);
+        imag_wraps += (((imag_acc ^ sum) & (im ^ sum)) < 0) ? ((im < 0) ? -1 : 1) : 0;
+        imag_acc = sum;
+
+        len--;
+    }
+
+    S->realBuffer[core_id] = real_acc;
+    S->imagBuffer[core_id] = imag_acc;
+    S->realWraps[core_id] = real_wraps;
+    S->imagWraps[core_id] = imag_wraps;
+#else
+    plp_cmplx_dot_prod_q32_xpulpv2(S->pSrcA + 2 * start,
+                                   S->pSrcB + 2 * start,
+                                   len,
+                                   S->deciPoint,
+                                   &S->realBuffer[core_id],
+                                   &S->imagBuffer[core_id]);
+#endif
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of cmplx_dot_prod group
+ */
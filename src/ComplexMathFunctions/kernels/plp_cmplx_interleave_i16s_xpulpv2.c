@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_interleave_i16s_xpulpv2.c
+ * Description:  16-bit complex interleave for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxInterleave
+  @{
+ */
+
+/**
+  @brief         16-bit complex interleave for XPULPV2.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the interleaved output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+  @par
+  Two samples are merged or split per word with __builtin_shuffle, hence all vectors
+  must be aligned to 4 bytes.
+ */
+
+void plp_cmplx_interleave_i16s_xpulpv2(const int16_t *__restrict__ pSrcRe,
+                                       const int16_t *__restrict__ pSrcIm,
+                                       int16_t *__restrict__ pDst,
+                                       uint32_t numSamples) {
+
+    uint32_t i;
+    v2s re, im;
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        re = *(v2s *)&pSrcRe[i];
+        im = *(v2s *)&pSrcIm[i];
+        *(v2s *)&pDst[2 * i] = __builtin_shuffle(re, im, (v2s){ 0, 2 });
+        *(v2s *)&pDst[2 * i + 2] = __builtin_shuffle(re, im, (v2s){ 1, 3 });
+    }
+
+    if (numSamples % 2 == 1) {
+        pDst[2 * i] = pSrcRe[i];
+        pDst[2 * i + 1] = pSrcIm[i];
+    }
+}
+
+/**
+  @} end of CmplxInterleave group
+ */
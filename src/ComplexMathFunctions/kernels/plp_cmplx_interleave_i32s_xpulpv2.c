@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_interleave_i32s_xpulpv2.c
+ * Description:  32-bit complex interleave for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxInterleave
+  @{
+ */
+
+/**
+  @brief         32-bit complex interleave for XPULPV2.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the interleaved output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_interleave_i32s_xpulpv2(const int32_t *__restrict__ pSrcRe,
+                                       const int32_t *__restrict__ pSrcIm,
+                                       int32_t *__restrict__ pDst,
+                                       uint32_t numSamples) {
+
+    uint32_t i;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        pDst[2 * i] = pSrcRe[i];
+        pDst[2 * i + 1] = pSrcIm[i];
+        pDst[2 * i + 2] = pSrcRe[i + 1];
+        pDst[2 * i + 3] = pSrcIm[i + 1];
+    }
+
+    if (numSamples % 2 == 1) {
+        pDst[2 * i] = pSrcRe[i];
+        pDst[2 * i + 1] = pSrcIm[i];
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        pDst[2 * i] = pSrcRe[i];
+        pDst[2 * i + 1] = pSrcIm[i];
+    }
+
+#endif
+}
+
+/**
+  @} end of CmplxInterleave group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mac_f32s_xpulpv2.c
+ * Description:  Floating-point complex multiply-accumulate for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxMac
+  @{
+ */
+
+/**
+  @brief         Floating-point complex multiply-accumulate for XPULPV2.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                const float32_t *__restrict__ pSrcB,
+                                float32_t *__restrict__ pAcc,
+                                uint32_t numSamples) {
+
+    uint32_t i;
+    float32_t a, b, c, d;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+        pAcc[2 * i] += (a * c) - (b * d);
+        pAcc[2 * i + 1] += (a * d) + (b * c);
+        a = pSrcA[2 * i + 2];
+        b = pSrcA[2 * i + 2 + 1];
+        c = pSrcB[2 * i + 2];
+        d = pSrcB[2 * i + 2 + 1];
+        pAcc[2 * i + 2] += (a * c) - (b * d);
+        pAcc[2 * i + 2 + 1] += (a * d) + (b * c);
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+        pAcc[2 * i] += (a * c) - (b * d);
+        pAcc[2 * i + 1] += (a * d) + (b * c);
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+        pAcc[2 * i] += (a * c) - (b * d);
+        pAcc[2 * i + 1] += (a * d) + (b * c);
+    }
+
+#endif
+}
+
+/**
+  @} end of CmplxMac group
+ */
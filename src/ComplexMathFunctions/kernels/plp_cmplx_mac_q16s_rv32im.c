@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mac_q16s_rv32im.c
+ * Description:  16-bit fixed-point complex multiply-accumulate for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxMac
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point complex multiply-accumulate for RV32IM.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               int16_t *__restrict__ pAcc,
+                               uint32_t deciPoint,
+                               uint32_t numSamples) {
+
+    uint32_t i;
+    int16_t a, b, c, d, dClip;
+    int32_t re, im;
+    int32_t rnd = ((int32_t)1 << deciPoint) >> 1; // round to nearest
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+        dClip = (d < -32767) ? -32767 : d; // negated imaginary part, as in the XPULPV2 kernel
+        re = a * c - b * dClip;
+        im = a * d + b * c;
+        pAcc[2 * i] += (re + rnd) >> deciPoint;
+        pAcc[2 * i + 1] += (im + rnd) >> deciPoint;
+    }
+}
+
+/**
+  @} end of CmplxMac group
+ */
@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mac_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point complex multiply-accumulate for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxMac
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point complex multiply-accumulate for XPULPV2.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                int16_t *__restrict__ pAcc,
+                                uint32_t deciPoint,
+                                uint32_t numSamples) {
+
+    uint32_t i;
+    v2s a, b, bClip;
+    int32_t re, im;
+
+    // the imaginary part of B is negated in a packed operand, where -32768 would wrap. bClip
+    // holds it clipped to -32767, as in the RV32IM kernel.
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        a = *(v2s *)&pSrcA[2 * i];
+        b = *(v2s *)&pSrcB[2 * i];
+        bClip = __MAX2(b, ((v2s){ -32768, -32767 }));
+        re = __DOTP2(a, __PACK2(b[0], -bClip[1]));
+        im = __DOTP2(a, __PACK2(b[1], b[0]));
+        re = __ROUNDNORM_REG(re, deciPoint);
+        im = __ROUNDNORM_REG(im, deciPoint);
+        *(v2s *)&pAcc[2 * i] = __ADD2(*(v2s *)&pAcc[2 * i], __PACK2(re, im));
+        a = *(v2s *)&pSrcA[2 * i + 2];
+        b = *(v2s *)&pSrcB[2 * i + 2];
+        bClip = __MAX2(b, ((v2s){ -32768, -32767 }));
+        re = __DOTP2(a, __PACK2(b[0], -bClip[1]));
+        im = __DOTP2(a, __PACK2(b[1], b[0]));
+        re = __ROUNDNORM_REG(re, deciPoint);
+        im = __ROUNDNORM_REG(im, deciPoint);
+        *(v2s *)&pAcc[2 * i + 2] = __ADD2(*(v2s *)&pAcc[2 * i + 2], __PACK2(re, im));
+    }
+
+    if (numSamples % 2 == 1) {
+        a = *(v2s *)&pSrcA[2 * i];
+        b = *(v2s *)&pSrcB[2 * i];
+        bClip = __MAX2(b, ((v2s){ -32768, -32767 }));
+        re = __DOTP2(a, __PACK2(b[0], -bClip[1]));
+        im = __DOTP2(a, __PACK2(b[1], b[0]));
+        re = __ROUNDNORM_REG(re, deciPoint);
+        im = __ROUNDNORM_REG(im, deciPoint);
+        *(v2s *)&pAcc[2 * i] = __ADD2(*(v2s *)&pAcc[2 * i], __PACK2(re, im));
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        a = *(v2s *)&pSrcA[2 * i];
+        b = *(v2s *)&pSrcB[2 * i];
+        bClip = __MAX2(b, ((v2s){ -32768, -32767 }));
+        re = __DOTP2(a, __PACK2(b[0], -bClip[1]));
+        im = __DOTP2(a, __PACK2(b[1], b[0]));
+        re = __ROUNDNORM_REG(re, deciPoint);
+        im = __ROUNDNORM_REG(im, deciPoint);
+        *(v2s *)&pAcc[2 * i] = __ADD2(*(v2s *)&pAcc[2 * i], __PACK2(re, im));
+    }
+
+#endif
+}
+
+/**
+  @} end of CmplxMac group
+ */
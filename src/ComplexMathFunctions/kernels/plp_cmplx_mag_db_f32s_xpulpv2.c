@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_db_f32s_xpulpv2.c
+ * Description:  Floating-point complex magnitude in dB for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_db
+  @{
+ */
+
+/**
+  @brief         10 * log10(p) of a power.
+  @param[in]     p           squared magnitude
+  @return        dB, the smallest float for p = 0 or a denormal p
+ */
+static inline float32_t plp_cmplx_db_elem_f32(float32_t p) {
+    int32_t e, k;
+    float32_t fract;
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    conv.f = p;
+    if (conv.i <= 0x007FFFFF) {
+        return -3.402823466e+38f;
+    }
+
+    // p = m * 2^e, the table index are the top mantissa bits, the rest is interpolated
+    e = ((conv.i >> 23) & 0xFF) - 127;
+    k = (conv.i >> (23 - FAST_MATH_LOG2_TABLE_BITS)) & (FAST_MATH_LOG2_TABLE_SIZE - 1);
+    fract = (float32_t)(conv.i & ((1 << (23 - FAST_MATH_LOG2_TABLE_BITS)) - 1)) *
+            (1.0f / (1 << (23 - FAST_MATH_LOG2_TABLE_BITS)));
+
+    return 3.010299957f * ((float32_t)e + plp_log2_interp_f32(k, fract));
+}
+
+/**
+  @brief         Floating-point complex magnitude in dB for XPULPV2.
+  @param[in]     pSrc        points to the complex input vector
+  @param[out]    pRes        points to the real output vector, dB
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_db_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                   float32_t *__restrict__ pRes,
+                                   uint32_t numSamples) {
+
+    uint32_t i;
+    float32_t re, im;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        re = pSrc[2 * i];
+        im = pSrc[2 * i + 1];
+        pRes[i] = plp_cmplx_db_elem_f32(re * re + im * im);
+        re = pSrc[2 * i + 2];
+        im = pSrc[2 * i + 3];
+        pRes[i + 1] = plp_cmplx_db_elem_f32(re * re + im * im);
+    }
+
+    if (numSamples % 2 == 1) {
+        re = pSrc[2 * i];
+        im = pSrc[2 * i + 1];
+        pRes[i] = plp_cmplx_db_elem_f32(re * re + im * im);
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        re = pSrc[2 * i];
+        im = pSrc[2 * i + 1];
+        pRes[i] = plp_cmplx_db_elem_f32(re * re + im * im);
+    }
+
+#endif
+}
+
+/**
+  @} end of cmplx_mag_db group
+ */
@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_db_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point complex magnitude in dB for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_db
+  @{
+ */
+
+/**
+  @brief         10 * log10(p) of a power with 2 * fracBits fractional bits.
+  @param[in]     p           squared magnitude
+  @param[in]     fracBits    number of fractional bits of the complex input
+  @return        dB in Q8.8, saturated, the smallest value for p = 0
+ */
+static inline int16_t plp_cmplx_db_elem_q16(uint32_t p, uint32_t fracBits) {
+    uint32_t lead;
+    int32_t l, db;
+
+    if (p == 0) {
+        return (int16_t)0x8000;
+    }
+
+    // log2(p) in Q7.24 from the exponent and the interpolated log2 of the mantissa
+    lead = __builtin_clz(p);
+    l = (31 - (int32_t)lead - 2 * (int32_t)fracBits) * (1 << 24) +
+        (plp_log2_interp_q32(p << lead) >> 6);
+
+    db = ((int64_t)l * PLP_10LOG10_2_Q29 + ((int64_t)1 << 44)) >> 45;
+    return db > 32767 ? 32767 : (db < -32768 ? -32768 : db);
+}
+
+/**
+  @brief         16-bit fixed-point complex magnitude in dB for XPULPV2.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in]     fracBits    number of fractional bits of the input
+  @param[out]    pRes        points to the real output vector, dB in Q8.8
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_db_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   uint32_t fracBits,
+                                   int16_t *__restrict__ pRes,
+                                   uint32_t numSamples) {
+
+    uint32_t i;
+    v2s x;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        x = *(v2s *)&pSrc[2 * i];
+        pRes[i] = plp_cmplx_db_elem_q16((uint32_t)__DOTP2(x, x), fracBits);
+        x = *(v2s *)&pSrc[2 * i + 2];
+        pRes[i + 1] = plp_cmplx_db_elem_q16((uint32_t)__DOTP2(x, x), fracBits);
+    }
+
+    if (numSamples % 2 == 1) {
+        x = *(v2s *)&pSrc[2 * i];
+        pRes[i] = plp_cmplx_db_elem_q16((uint32_t)__DOTP2(x, x), fracBits);
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        x = *(v2s *)&pSrc[2 * i];
+        pRes[i] = plp_cmplx_db_elem_q16((uint32_t)__DOTP2(x, x), fracBits);
+    }
+
+#endif
+}
+
+/**
+  @} end of cmplx_mag_db group
+ */
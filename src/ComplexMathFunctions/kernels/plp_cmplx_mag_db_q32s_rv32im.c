@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_db_q32s_rv32im.c
+ * Description:  32-bit fixed-point complex magnitude in dB for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_db
+  @{
+ */
+
+/**
+  @brief         10 * log10(p) of a power with 2 * fracBits fractional bits.
+  @param[in]     p           squared magnitude
+  @param[in]     fracBits    number of fractional bits of the complex input
+  @return        dB in Q16.16, the smallest value for p = 0
+ */
+static inline int32_t plp_cmplx_db_elem_q32(uint64_t p, uint32_t fracBits) {
+    uint32_t lead;
+    int32_t l;
+
+    if (p == 0) {
+        return (int32_t)0x80000000;
+    }
+
+    // log2(p) in Q7.24 from the exponent and the interpolated log2 of the mantissa
+    lead = __builtin_clzll(p);
+    l = (63 - (int32_t)lead - 2 * (int32_t)fracBits) * (1 << 24) +
+        (plp_log2_interp_q32((uint32_t)((p << lead) >> 32)) >> 6);
+
+    return ((int64_t)l * PLP_10LOG10_2_Q29 + ((int64_t)1 << 36)) >> 37;
+}
+
+/**
+  @brief         32-bit fixed-point complex magnitude in dB for RV32IM.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in]     fracBits    number of fractional bits of the input
+  @param[out]    pRes        points to the real output vector, dB in Q16.16
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_db_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                  uint32_t fracBits,
+                                  int32_t *__restrict__ pRes,
+                                  uint32_t numSamples) {
+
+    uint32_t i;
+    int32_t re, im;
+    uint64_t p;
+
+    for (i = 0; i < numSamples; i++) {
+        re = pSrc[2 * i];
+        im = pSrc[2 * i + 1];
+        p = (uint64_t)((int64_t)re * re) + (uint64_t)((int64_t)im * im);
+        pRes[i] = plp_cmplx_db_elem_q32(p, fracBits);
+    }
+}
+
+/**
+  @} end of cmplx_mag_db group
+ */
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_fast_q16s_rv32im.c
+ * Description:  16-bit fixed-point fast approximate complex magnitude for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_fast
+  @{
+ */
+
+/**
+  @brief         Alpha-max-plus-beta-min magnitude of one q16 sample.
+  @param[in]     re          real part of the sample
+  @param[in]     im          imaginary part of the sample
+  @param[in]     pCoef       points to the {alpha, beta} pairs of the segments
+  @param[in]     numSeg      number of segments
+  @return        magnitude in the format of the input, saturated
+ */
+static inline int16_t plp_cmplx_mag_fast_elem_q16(int32_t re,
+                                                  int32_t im,
+                                                  const int16_t *pCoef,
+                                                  uint32_t numSeg) {
+    uint32_t s;
+    int32_t mx, mn, mag, tmp;
+
+    // absolute values, -32768 is treated as -32767 as in the XPULPV2 kernel
+    re = re < -32767 ? 32767 : (re < 0 ? -re : re);
+    im = im < -32767 ? 32767 : (im < 0 ? -im : im);
+    mx = re > im ? re : im;
+    mn = re > im ? im : re;
+
+    mag = mx * pCoef[0] + mn * pCoef[1];
+    for (s = 1; s < numSeg; s++) {
+        tmp = mx * pCoef[2 * s] + mn * pCoef[2 * s + 1];
+        mag = tmp > mag ? tmp : mag;
+    }
+
+    mag = (mag + (1 << 14)) >> 15;
+    return mag > 32767 ? 32767 : mag;
+}
+
+/**
+  @brief         16-bit fixed-point fast approximate complex magnitude for RV32IM.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in]     accuracy    PLP_CMPLX_MAG_FAST_LOW, _MEDIUM or _HIGH
+  @param[out]    pRes        points to the real output vector
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_fast_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                    uint32_t accuracy,
+                                    int16_t *__restrict__ pRes,
+                                    uint32_t numSamples) {
+
+    uint32_t i, numSeg;
+    const int16_t *pCoef;
+
+    if (accuracy > PLP_CMPLX_MAG_FAST_HIGH) {
+        accuracy = PLP_CMPLX_MAG_FAST_HIGH;
+    }
+    numSeg = 1U << accuracy;
+    pCoef = &magFastCoef_q16[2 * (numSeg - 1)];
+
+    for (i = 0; i < numSamples; i++) {
+        pRes[i] = plp_cmplx_mag_fast_elem_q16(pSrc[2 * i], pSrc[2 * i + 1], pCoef, numSeg);
+    }
+}
+
+/**
+  @} end of cmplx_mag_fast group
+ */
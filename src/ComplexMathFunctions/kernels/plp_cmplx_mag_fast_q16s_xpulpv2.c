@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_fast_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point fast approximate complex magnitude for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_fast
+  @{
+ */
+
+/**
+  @brief         Alpha-max-plus-beta-min magnitude of one q16 sample.
+  @param[in]     x           real and imaginary part of the sample
+  @param[in]     pCoef       points to the {alpha, beta} pairs of the segments
+  @param[in]     numSeg      number of segments
+  @return        magnitude in the format of the input, saturated
+ */
+static inline int16_t plp_cmplx_mag_fast_elem_q16(v2s x, const v2s *pCoef, uint32_t numSeg) {
+    uint32_t s;
+    int32_t mag;
+
+    // {max, min} of the absolute values, -32768 is treated as -32767
+    x = __ABS2(__MAX2(x, ((v2s){ -32767, -32767 })));
+    if (x[0] < x[1]) {
+        x = __builtin_shuffle(x, (v2s){ 1, 0 });
+    }
+
+    mag = __DOTP2(x, pCoef[0]);
+    for (s = 1; s < numSeg; s++) {
+        mag = __MAX(mag, __DOTP2(x, pCoef[s]));
+    }
+
+    return __CLIP(__ROUNDNORM_REG(mag, 15), 15);
+}
+
+/**
+  @brief         16-bit fixed-point fast approximate complex magnitude for XPULPV2.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in]     accuracy    PLP_CMPLX_MAG_FAST_LOW, _MEDIUM or _HIGH
+  @param[out]    pRes        points to the real output vector
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_fast_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                     uint32_t accuracy,
+                                     int16_t *__restrict__ pRes,
+                                     uint32_t numSamples) {
+
+    uint32_t i, s, numSeg;
+    v2s pCoef[4];
+
+    if (accuracy > PLP_CMPLX_MAG_FAST_HIGH) {
+        accuracy = PLP_CMPLX_MAG_FAST_HIGH;
+    }
+    numSeg = 1U << accuracy;
+    for (s = 0; s < numSeg; s++) {
+        pCoef[s] = __PACK2(magFastCoef_q16[2 * (numSeg - 1 + s)],
+                           magFastCoef_q16[2 * (numSeg - 1 + s) + 1]);
+    }
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        pRes[i] = plp_cmplx_mag_fast_elem_q16(*(v2s *)&pSrc[2 * i], pCoef, numSeg);
+        pRes[i + 1] = plp_cmplx_mag_fast_elem_q16(*(v2s *)&pSrc[2 * i + 2], pCoef, numSeg);
+    }
+
+    if (numSamples % 2 == 1) {
+        pRes[i] = plp_cmplx_mag_fast_elem_q16(*(v2s *)&pSrc[2 * i], pCoef, numSeg);
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        pRes[i] = plp_cmplx_mag_fast_elem_q16(*(v2s *)&pSrc[2 * i], pCoef, numSeg);
+    }
+
+#endif
+}
+
+/**
+  @} end of cmplx_mag_fast group
+ */
@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_fast_q32s_rv32im.c
+ * Description:  32-bit fixed-point fast approximate complex magnitude for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_fast
+  @{
+ */
+
+/**
+  @brief         Alpha-max-plus-beta-min magnitude of one q32 sample.
+  @param[in]     re          real part of the sample
+  @param[in]     im          imaginary part of the sample
+  @param[in]     pCoef       points to the {alpha, beta} pairs of the segments
+  @param[in]     numSeg      number of segments
+  @return        magnitude in the format of the input, saturated
+ */
+static inline int32_t plp_cmplx_mag_fast_elem_q32(int32_t re,
+                                                  int32_t im,
+                                                  const int32_t *pCoef,
+                                                  uint32_t numSeg) {
+    uint32_t s, a, b, mx, mn;
+    uint64_t mag, tmp;
+
+    a = re < 0 ? -(uint32_t)re : (uint32_t)re;
+    b = im < 0 ? -(uint32_t)im : (uint32_t)im;
+    mx = a > b ? a : b;
+    mn = a > b ? b : a;
+
+    mag = (uint64_t)mx * (uint32_t)pCoef[0] + (uint64_t)mn * (uint32_t)pCoef[1];
+    for (s = 1; s < numSeg; s++) {
+        tmp = (uint64_t)mx * (uint32_t)pCoef[2 * s] + (uint64_t)mn * (uint32_t)pCoef[2 * s + 1];
+        mag = tmp > mag ? tmp : mag;
+    }
+
+    mag = (mag + (1U << 30)) >> 31;
+    return mag > 0x7FFFFFFF ? 0x7FFFFFFF : (int32_t)mag;
+}
+
+/**
+  @brief         32-bit fixed-point fast approximate complex magnitude for RV32IM.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in]     accuracy    PLP_CMPLX_MAG_FAST_LOW, _MEDIUM or _HIGH
+  @param[out]    pRes        points to the real output vector
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_fast_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                    uint32_t accuracy,
+                                    int32_t *__restrict__ pRes,
+                                    uint32_t numSamples) {
+
+    uint32_t i, numSeg;
+    const int32_t *pCoef;
+
+    if (accuracy > PLP_CMPLX_MAG_FAST_HIGH) {
+        accuracy = PLP_CMPLX_MAG_FAST_HIGH;
+    }
+    numSeg = 1U << accuracy;
+    pCoef = &magFastCoef_q32[2 * (numSeg - 1)];
+
+    for (i = 0; i < numSamples; i++) {
+        pRes[i] = plp_cmplx_mag_fast_elem_q32(pSrc[2 * i], pSrc[2 * i + 1], pCoef, numSeg);
+    }
+}
+
+/**
+  @} end of cmplx_mag_fast group
+ */
@@ -36,6 +36,7 @@
 
 #include "plp_math.h"
 
+#define CMPLX_MAG_Q8_BLOCK 16
 
 /**
   @ingroup groupCmplxMath
@@ -78,7 +79,32 @@ void plp_cmplx_mag_q8s_rv32im(const int8_t *pSrc,
                                const uint32_t fracBits,
                                int8_t *pRes,
                                uint32_t numSamples){
-    printf("Error: plp_sqrt_q8 not implemented yet!\n");
+
+    int32_t sqr[CMPLX_MAG_Q8_BLOCK];
+    int32_t mag[CMPLX_MAG_Q8_BLOCK];
+    int32_t real, cmplx;
+    uint32_t blkCnt, blkSize, i;
+
+    /* sqrt(real^2 + imag^2) has the same fractional bits as the input, hence the squared
+       magnitudes are taken as integers and the square root is computed block-wise */
+    for (blkCnt = 0; blkCnt < numSamples; blkCnt += blkSize) {
+        blkSize = numSamples - blkCnt;
+        if (blkSize > CMPLX_MAG_Q8_BLOCK) {
+            blkSize = CMPLX_MAG_Q8_BLOCK;
+        }
+
+        for (i = 0; i < blkSize; i++) {
+            real = *pSrc++;
+            cmplx = *pSrc++;
+            sqr[i] = real * real + cmplx * cmplx;
+        }
+
+        plp_sqrt_vec_q32s_rv32im(sqr, blkSize, 0, mag);
+
+        for (i = 0; i < blkSize; i++) {
+            pRes[blkCnt + i] = (mag[i] > 0x7F) ? 0x7F : mag[i];
+        }
+    }
 }
 
 /**
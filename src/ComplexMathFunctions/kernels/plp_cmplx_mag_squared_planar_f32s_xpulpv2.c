@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_planar_f32s_xpulpv2.c
+ * Description:  Floating-point planar complex squared magnitude for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_planar
+  @{
+ */
+
+/**
+  @brief         Floating-point planar complex squared magnitude for XPULPV2.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the real output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_f32s_xpulpv2(const float32_t *__restrict__ pSrcRe,
+                                               const float32_t *__restrict__ pSrcIm,
+                                               float32_t *__restrict__ pDst,
+                                               uint32_t numSamples) {
+
+    uint32_t i;
+    float32_t a, b;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        a = pSrcRe[i];
+        b = pSrcIm[i];
+        pDst[i] = (a * a) + (b * b);
+        a = pSrcRe[i + 1];
+        b = pSrcIm[i + 1];
+        pDst[i + 1] = (a * a) + (b * b);
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcRe[i];
+        b = pSrcIm[i];
+        pDst[i] = (a * a) + (b * b);
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcRe[i];
+        b = pSrcIm[i];
+        pDst[i] = (a * a) + (b * b);
+    }
+
+#endif
+}
+
+/**
+  @} end of cmplx_mag_squared_planar group
+ */
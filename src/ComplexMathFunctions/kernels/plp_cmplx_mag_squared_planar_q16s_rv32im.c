@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_planar_q16s_rv32im.c
+ * Description:  16-bit fixed-point planar complex squared magnitude for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_planar
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point planar complex squared magnitude for RV32IM.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the real output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_q16s_rv32im(const int16_t *__restrict__ pSrcRe,
+                                              const int16_t *__restrict__ pSrcIm,
+                                              int16_t *__restrict__ pDst,
+                                              uint32_t deciPoint,
+                                              uint32_t numSamples) {
+
+    uint32_t i;
+    int16_t a, b;
+    int32_t mag;
+    int32_t rnd = ((int32_t)1 << deciPoint) >> 1; // round to nearest
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcRe[i];
+        b = pSrcIm[i];
+        mag = a * a + b * b;
+        pDst[i] = (mag + rnd) >> deciPoint;
+    }
+}
+
+/**
+  @} end of cmplx_mag_squared_planar group
+ */
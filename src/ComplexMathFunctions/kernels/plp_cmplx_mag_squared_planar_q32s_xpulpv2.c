@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_planar_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point planar complex squared magnitude for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_planar
+  @{
+ */
+
+/**
+  @brief         32-bit fixed-point planar complex squared magnitude for XPULPV2.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the real output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_q32s_xpulpv2(const int32_t *__restrict__ pSrcRe,
+                                               const int32_t *__restrict__ pSrcIm,
+                                               int32_t *__restrict__ pDst,
+                                               uint32_t deciPoint,
+                                               uint32_t numSamples) {
+
+    uint32_t i;
+    int32_t a, b;
+    int64_t mag;
+    int64_t rnd = ((int64_t)1 << deciPoint) >> 1; // round to nearest
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        a = pSrcRe[i];
+        b = pSrcIm[i];
+        mag = (int64_t)a * a + (int64_t)b * b;
+        pDst[i] = (mag + rnd) >> deciPoint;
+        a = pSrcRe[i + 1];
+        b = pSrcIm[i + 1];
+        mag = (int64_t)a * a + (int64_t)b * b;
+        pDst[i + 1] = (mag + rnd) >> deciPoint;
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcRe[i];
+        b = pSrcIm[i];
+        mag = (int64_t)a * a + (int64_t)b * b;
+        pDst[i] = (mag + rnd) >> deciPoint;
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcRe[i];
+        b = pSrcIm[i];
+        mag = (int64_t)a * a + (int64_t)b * b;
+        pDst[i] = (mag + rnd) >> deciPoint;
+    }
+
+#endif
+}
+
+/**
+  @} end of cmplx_mag_squared_planar group
+ */
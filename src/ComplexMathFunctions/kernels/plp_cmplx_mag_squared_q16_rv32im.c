@@ -79,6 +79,10 @@ void plp_cmplx_mag_squared_q16_rv32im(const int16_t *__restrict__ pSrc,
                                       uint32_t numSamples) {
     uint32_t blkCnt;    /* Loop counter */
     int16_t real, imag; /* Temporary input variables */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    uint32_t mag;
+    uint32_t rnd = (1U << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -88,8 +92,15 @@ void plp_cmplx_mag_squared_q16_rv32im(const int16_t *__restrict__ pSrc,
         real = *pSrc++;
         imag = *pSrc++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        mag = (uint32_t)(real * real) + (uint32_t)(imag * imag);
+        mag = (mag + rnd) >> deciPoint;
+        *pDst++ = (mag > 0x7FFF) ? 0x7FFF : mag;
+#else
         /* store result in destination buffer. */
         *pDst++ = ((real * real) >> deciPoint) + ((imag * imag) >> deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
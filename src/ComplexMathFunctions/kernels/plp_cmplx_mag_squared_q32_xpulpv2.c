@@ -79,6 +79,10 @@ void plp_cmplx_mag_squared_q32_xpulpv2(const int32_t *__restrict__ pSrc,
                                        uint32_t numSamples) {
     uint32_t blkCnt;    /* Loop counter */
     int32_t real, imag; /* Temporary input variables */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    uint64_t mag;
+    uint64_t rnd = ((uint64_t)1 << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -88,8 +92,15 @@ void plp_cmplx_mag_squared_q32_xpulpv2(const int32_t *__restrict__ pSrc,
         real = *pSrc++;
         imag = *pSrc++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        mag = (uint64_t)((int64_t)real * real) + (uint64_t)((int64_t)imag * imag);
+        mag = (mag + rnd) >> deciPoint;
+        *pDst++ = (mag > 0x7FFFFFFF) ? 0x7FFFFFFF : mag;
+#else
         /* store result in destination buffer. */
         *pDst++ = __ROUNDNORM_REG(real * real, deciPoint) + __ROUNDNORM_REG(imag * imag, deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
@@ -88,8 +88,13 @@ void plp_cmplx_mag_squared_q8_xpulpv2(const int8_t *__restrict__ pSrc,
         real = *pSrc++;
         imag = *pSrc++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        *pDst++ = __CLIP(__ROUNDNORM_REG(real * real + imag * imag, deciPoint), 7);
+#else
         /* store result in destination buffer. */
         *pDst++ = __ROUNDNORM_REG(real * real, deciPoint) + __ROUNDNORM_REG(imag * imag, deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_cmplx_planar_f32s_xpulpv2.c
+ * Description:  Floating-point planar complex-by-complex multiplication for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxByCmplxMultPlanar
+  @{
+ */
+
+/**
+  @brief         Floating-point planar complex-by-complex multiplication for XPULPV2.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_f32s_xpulpv2(const float32_t *__restrict__ pSrcARe,
+                                              const float32_t *__restrict__ pSrcAIm,
+                                              const float32_t *__restrict__ pSrcBRe,
+                                              const float32_t *__restrict__ pSrcBIm,
+                                              float32_t *__restrict__ pDstRe,
+                                              float32_t *__restrict__ pDstIm,
+                                              uint32_t numSamples) {
+
+    uint32_t i;
+    float32_t a, b, c, d;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        pDstRe[i] = (a * c) - (b * d);
+        pDstIm[i] = (a * d) + (b * c);
+        a = pSrcARe[i + 1];
+        b = pSrcAIm[i + 1];
+        c = pSrcBRe[i + 1];
+        d = pSrcBIm[i + 1];
+        pDstRe[i + 1] = (a * c) - (b * d);
+        pDstIm[i + 1] = (a * d) + (b * c);
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        pDstRe[i] = (a * c) - (b * d);
+        pDstIm[i] = (a * d) + (b * c);
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        pDstRe[i] = (a * c) - (b * d);
+        pDstIm[i] = (a * d) + (b * c);
+    }
+
+#endif
+}
+
+/**
+  @} end of CmplxByCmplxMultPlanar group
+ */
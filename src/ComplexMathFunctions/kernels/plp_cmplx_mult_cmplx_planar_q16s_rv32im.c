@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_cmplx_planar_q16s_rv32im.c
+ * Description:  16-bit fixed-point planar complex-by-complex multiplication for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxByCmplxMultPlanar
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point planar complex-by-complex multiplication for RV32IM.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16s_rv32im(const int16_t *__restrict__ pSrcARe,
+                                             const int16_t *__restrict__ pSrcAIm,
+                                             const int16_t *__restrict__ pSrcBRe,
+                                             const int16_t *__restrict__ pSrcBIm,
+                                             int16_t *__restrict__ pDstRe,
+                                             int16_t *__restrict__ pDstIm,
+                                             uint32_t deciPoint,
+                                             uint32_t numSamples) {
+
+    uint32_t i;
+    int16_t a, b, c, d;
+    int32_t re, im;
+    int32_t rnd = ((int32_t)1 << deciPoint) >> 1; // round to nearest
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        re = a * c - b * ((d < -32767) ? -32767 : d); // negated imaginary part, as in XPULPV2
+        im = a * d + b * c;
+        pDstRe[i] = (re + rnd) >> deciPoint;
+        pDstIm[i] = (im + rnd) >> deciPoint;
+    }
+}
+
+/**
+  @} end of CmplxByCmplxMultPlanar group
+ */
@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_cmplx_planar_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point planar complex-by-complex multiplication for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxByCmplxMultPlanar
+  @{
+ */
+
+/**
+  @brief         16-bit fixed-point planar complex-by-complex multiplication for XPULPV2.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+  @par
+  The products are computed with packed dot products on pairs of samples, the sign of the
+  imaginary part of pSrcB is flipped inside the packed operand as in plp_cmplx_mult_conj_q16.
+  Hence the imaginary part of pSrcB must not be -32768.
+  @par
+  Two samples are processed per word, hence all vectors must be aligned to 4 bytes.
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16s_xpulpv2(const int16_t *__restrict__ pSrcARe,
+                                              const int16_t *__restrict__ pSrcAIm,
+                                              const int16_t *__restrict__ pSrcBRe,
+                                              const int16_t *__restrict__ pSrcBIm,
+                                              int16_t *__restrict__ pDstRe,
+                                              int16_t *__restrict__ pDstIm,
+                                              uint32_t deciPoint,
+                                              uint32_t numSamples) {
+
+    uint32_t i;
+    v2s aRe, aIm, bRe, bIm, bImNeg, x;
+    int32_t re0, im0, re1, im1;
+    int16_t a, b, c, d;
+    int32_t re, im;
+
+    // the imaginary part of B is negated in packed operands, where -32768 would wrap. It is
+    // clipped to -32767 first, also in the scalar tail and in the RV32IM kernel.
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        aRe = *(v2s *)&pSrcARe[i];
+        aIm = *(v2s *)&pSrcAIm[i];
+        bRe = *(v2s *)&pSrcBRe[i];
+        bIm = *(v2s *)&pSrcBIm[i];
+        bImNeg = -__MAX2(bIm, ((v2s){ -32767, -32767 }));
+
+        /* {a.re, a.im} times {b.re, -b.im} and {b.im, b.re} for sample i and i + 1 */
+        x = __builtin_shuffle(aRe, aIm, (v2s){ 0, 2 });
+        re0 = __DOTP2(x, __builtin_shuffle(bRe, bImNeg, (v2s){ 0, 2 }));
+        im0 = __DOTP2(x, __builtin_shuffle(bIm, bRe, (v2s){ 0, 2 }));
+        x = __builtin_shuffle(aRe, aIm, (v2s){ 1, 3 });
+        re1 = __DOTP2(x, __builtin_shuffle(bRe, bImNeg, (v2s){ 1, 3 }));
+        im1 = __DOTP2(x, __builtin_shuffle(bIm, bRe, (v2s){ 1, 3 }));
+
+        *(v2s *)&pDstRe[i] = __PACK2(__ROUNDNORM_REG(re0, deciPoint),
+                                     __ROUNDNORM_REG(re1, deciPoint));
+        *(v2s *)&pDstIm[i] = __PACK2(__ROUNDNORM_REG(im0, deciPoint),
+                                     __ROUNDNORM_REG(im1, deciPoint));
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcARe[i];
+        b = pSrcAIm[i];
+        c = pSrcBRe[i];
+        d = pSrcBIm[i];
+        re = a * c - b * ((d < -32767) ? -32767 : d);
+        im = a * d + b * c;
+        pDstRe[i] = __ROUNDNORM_REG(re, deciPoint);
+        pDstIm[i] = __ROUNDNORM_REG(im, deciPoint);
+    }
+}
+
+/**
+  @} end of CmplxByCmplxMultPlanar group
+ */
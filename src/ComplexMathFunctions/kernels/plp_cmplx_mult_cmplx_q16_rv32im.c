@@ -72,6 +72,11 @@ void plp_cmplx_mult_cmplx_q16_rv32im(const int16_t *__restrict__ pSrcA,
                                      uint32_t numSamples) {
     uint32_t blkCnt;    /* Loop counter */
     int16_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int32_t re;
+    int64_t im; // a * d + b * c reaches 2^31 for (-1 - 1i) * (-1 - 1i)
+    int32_t rnd = (1 << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -84,9 +89,17 @@ void plp_cmplx_mult_cmplx_q16_rv32im(const int16_t *__restrict__ pSrcA,
         c = *pSrcB++;
         d = *pSrcB++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        re = (a * c - b * d + rnd) >> deciPoint;
+        im = ((int64_t)(a * d) + b * c + rnd) >> deciPoint;
+        *pDst++ = (re > 0x7FFF) ? 0x7FFF : ((re < -0x8000) ? -0x8000 : re);
+        *pDst++ = (im > 0x7FFF) ? 0x7FFF : ((im < -0x8000) ? -0x8000 : im);
+#else
         /* store result in destination buffer. */
         *pDst++ = (((a * c)) >> deciPoint) - (((b * d)) >> deciPoint);
         *pDst++ = (((a * d)) >> deciPoint) + (((b * c)) >> deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
@@ -73,6 +73,10 @@ void plp_cmplx_mult_cmplx_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
                                       uint32_t numSamples) {
     uint32_t blkCnt;    /* Loop counter */
     int16_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int64_t im; // a * d + b * c reaches 2^31 for (-1 - 1i) * (-1 - 1i)
+    int32_t rnd = (1 << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -85,9 +89,16 @@ void plp_cmplx_mult_cmplx_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
         c = *pSrcB++;
         d = *pSrcB++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        *pDst++ = __CLIP(__ROUNDNORM_REG(a * c - b * d, deciPoint), 15);
+        im = ((int64_t)(a * d) + b * c + rnd) >> deciPoint;
+        *pDst++ = (im > 0x7FFF) ? 0x7FFF : ((im < -0x8000) ? -0x8000 : im);
+#else
         /* store result in destination buffer. */
         *pDst++ = __ROUNDNORM_REG((a * c), deciPoint) - __ROUNDNORM_REG((b * d), deciPoint);
         *pDst++ = __ROUNDNORM_REG((a * d), deciPoint) + __ROUNDNORM_REG((b * c), deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
@@ -74,6 +74,10 @@ void plp_cmplx_mult_cmplx_q32_xpulpv2(const int32_t *__restrict__ pSrcA,
 
     uint32_t blkCnt;    /* Loop counter */
     int32_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int64_t re, im;
+    int64_t rnd = ((int64_t)1 << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -86,9 +90,19 @@ void plp_cmplx_mult_cmplx_q32_xpulpv2(const int32_t *__restrict__ pSrcA,
         c = *pSrcB++;
         d = *pSrcB++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        re = ((int64_t)a * c - (int64_t)b * d + rnd) >> deciPoint;
+        /* a * d + b * c reaches 2^63 only for (-1 - 1i) * (-1 - 1i), it wraps to INT64_MIN */
+        im = (int64_t)((uint64_t)((int64_t)a * d) + (uint64_t)((int64_t)b * c));
+        im = (im == INT64_MIN) ? INT64_MAX : ((im + rnd) >> deciPoint);
+        *pDst++ = (re > 0x7FFFFFFF) ? 0x7FFFFFFF : ((re < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : re);
+        *pDst++ = (im > 0x7FFFFFFF) ? 0x7FFFFFFF : ((im < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : im);
+#else
         /* store result in destination buffer. */
         *pDst++ = __ROUNDNORM_REG((a * c), deciPoint) - __ROUNDNORM_REG((b * d), deciPoint);
         *pDst++ = __ROUNDNORM_REG((a * d), deciPoint) + __ROUNDNORM_REG((b * c), deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
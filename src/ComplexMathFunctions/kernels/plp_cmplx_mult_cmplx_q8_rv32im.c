@@ -73,6 +73,10 @@ void plp_cmplx_mult_cmplx_q8_rv32im(const int8_t *__restrict__ pSrcA,
                                     uint32_t numSamples) {
     uint32_t blkCnt;   /* Loop counter */
     int8_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int32_t re, im;
+    int32_t rnd = (1 << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -85,9 +89,17 @@ void plp_cmplx_mult_cmplx_q8_rv32im(const int8_t *__restrict__ pSrcA,
         c = *pSrcB++;
         d = *pSrcB++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        re = (a * c - b * d + rnd) >> deciPoint;
+        im = (a * d + b * c + rnd) >> deciPoint;
+        *pDst++ = (re > 0x7F) ? 0x7F : ((re < -0x80) ? -0x80 : re);
+        *pDst++ = (im > 0x7F) ? 0x7F : ((im < -0x80) ? -0x80 : im);
+#else
         /* store result in destination buffer. */
         *pDst++ = (((a * c)) >> deciPoint) - (((b * d)) >> deciPoint);
         *pDst++ = (((a * d)) >> deciPoint) + (((b * c)) >> deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
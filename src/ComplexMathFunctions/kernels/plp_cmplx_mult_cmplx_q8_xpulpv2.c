@@ -85,9 +85,15 @@ void plp_cmplx_mult_cmplx_q8_xpulpv2(const int8_t *__restrict__ pSrcA,
         c = *pSrcB++;
         d = *pSrcB++;
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* round the full precision result once and saturate it */
+        *pDst++ = __CLIP(__ROUNDNORM_REG(a * c - b * d, deciPoint), 7);
+        *pDst++ = __CLIP(__ROUNDNORM_REG(a * d + b * c, deciPoint), 7);
+#else
         /* store result in destination buffer. */
         *pDst++ = __ROUNDNORM_REG((a * c), deciPoint) - __ROUNDNORM_REG((b * d), deciPoint);
         *pDst++ = __ROUNDNORM_REG((a * d), deciPoint) + __ROUNDNORM_REG((b * c), deciPoint);
+#endif
 
         /* Decrement loop counter */
         blkCnt--;
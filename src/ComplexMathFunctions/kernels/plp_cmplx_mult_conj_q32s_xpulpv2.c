@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_conj_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point complex-by-conjugate multiplication for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxByConjMult
+  @{
+ */
+
+/**
+  @brief         32-bit fixed-point complex-by-conjugate multiplication for XPULPV2.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mult_conj_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                      const int32_t *__restrict__ pSrcB,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples) {
+
+    uint32_t i;
+    int32_t a, b, c, d;
+    int64_t re, im;
+    int64_t rnd = ((int64_t)1 << deciPoint) >> 1; // round to nearest
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (i = 0; i < (numSamples & ~1U); i += 2) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+        re = (int64_t)a * c + (int64_t)b * d;
+        im = (int64_t)b * c - (int64_t)a * d;
+        pDst[2 * i] = (re + rnd) >> deciPoint;
+        pDst[2 * i + 1] = (im + rnd) >> deciPoint;
+        a = pSrcA[2 * i + 2];
+        b = pSrcA[2 * i + 2 + 1];
+        c = pSrcB[2 * i + 2];
+        d = pSrcB[2 * i + 2 + 1];
+        re = (int64_t)a * c + (int64_t)b * d;
+        im = (int64_t)b * c - (int64_t)a * d;
+        pDst[2 * i + 2] = (re + rnd) >> deciPoint;
+        pDst[2 * i + 2 + 1] = (im + rnd) >> deciPoint;
+    }
+
+    if (numSamples % 2 == 1) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+        re = (int64_t)a * c + (int64_t)b * d;
+        im = (int64_t)b * c - (int64_t)a * d;
+        pDst[2 * i] = (re + rnd) >> deciPoint;
+        pDst[2 * i + 1] = (im + rnd) >> deciPoint;
+    }
+
+#else
+
+    for (i = 0; i < numSamples; i++) {
+        a = pSrcA[2 * i];
+        b = pSrcA[2 * i + 1];
+        c = pSrcB[2 * i];
+        d = pSrcB[2 * i + 1];
+        re = (int64_t)a * c + (int64_t)b * d;
+        im = (int64_t)b * c - (int64_t)a * d;
+        pDst[2 * i] = (re + rnd) >> deciPoint;
+        pDst[2 * i + 1] = (im + rnd) >> deciPoint;
+    }
+
+#endif
+}
+
+/**
+  @} end of CmplxByConjMult group
+ */
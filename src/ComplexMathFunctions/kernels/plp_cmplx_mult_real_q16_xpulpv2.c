@@ -88,6 +88,13 @@ void plp_cmplx_mult_real_q16_xpulpv2(const int16_t *__restrict__ pSrcCmplx,
         /* C[2 * i    ] = A[2 * i    ] * B[i]. */
         /* C[2 * i + 1] = A[2 * i + 1] * B[i]. */
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        if (even == 1) {
+            in = *pSrcReal++;
+        }
+        /* round the product to nearest and saturate it */
+        *pDst++ = __CLIP(__ROUNDNORM_REG((*pSrcCmplx++ * in), deciPoint), 15);
+#else
         if (even == 1) {
             in = *pSrcReal++;
             /* store result in destination buffer. */
@@ -95,6 +102,7 @@ void plp_cmplx_mult_real_q16_xpulpv2(const int16_t *__restrict__ pSrcCmplx,
         } else {
             *pDst++ = __ROUNDNORM_REG((*pSrcCmplx++ * in), deciPoint);
         }
+#endif
         even = !even;
         /* Decrement loop counter */
         blkCnt--;
@@ -80,6 +80,10 @@ void plp_cmplx_mult_real_q32_xpulpv2(const int32_t *__restrict__ pSrcCmplx,
                                      uint32_t numSamples) {
     uint32_t blkCnt; /* Loop counter */
     int32_t in;      /* Temporary variable */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int64_t prod;
+    int64_t rnd = ((int64_t)1 << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = 2 * numSamples;
@@ -88,6 +92,16 @@ void plp_cmplx_mult_real_q32_xpulpv2(const int32_t *__restrict__ pSrcCmplx,
         /* C[2 * i    ] = A[2 * i    ] * B[i]. */
         /* C[2 * i + 1] = A[2 * i + 1] * B[i]. */
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        if (even == 1) {
+            in = *pSrcReal++;
+        }
+        /* round the product to nearest and saturate it */
+        prod = ((int64_t)*pSrcCmplx++ * in + rnd) >> deciPoint;
+        prod = (prod > 0x7FFFFFFF) ? 0x7FFFFFFF : prod;
+        prod = (prod < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : prod;
+        *pDst++ = prod;
+#else
         if (even == 1) {
             in = *pSrcReal++;
             /* store result in destination buffer. */
@@ -95,6 +109,7 @@ void plp_cmplx_mult_real_q32_xpulpv2(const int32_t *__restrict__ pSrcCmplx,
         } else {
             *pDst++ = __ROUNDNORM_REG((*pSrcCmplx++ * in), deciPoint);
         }
+#endif
         even = !even;
         /* Decrement loop counter */
         blkCnt--;
@@ -80,6 +80,10 @@ void plp_cmplx_mult_real_q8_rv32im(const int8_t *__restrict__ pSrcCmplx,
                                    uint32_t numSamples) {
     uint32_t blkCnt; /* Loop counter */
     int8_t in;       /* Temporary variable */
+#if defined(PLP_MATH_CMPLX_SATURATE)
+    int32_t prod;
+    int32_t rnd = (1 << deciPoint) >> 1; // round to nearest
+#endif
 
     /* Initialize blkCnt with number of samples */
     blkCnt = 2 * numSamples;
@@ -88,6 +92,14 @@ void plp_cmplx_mult_real_q8_rv32im(const int8_t *__restrict__ pSrcCmplx,
         /* C[2 * i    ] = A[2 * i    ] * B[i]. */
         /* C[2 * i + 1] = A[2 * i + 1] * B[i]. */
 
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        if (even == 1) {
+            in = *pSrcReal++;
+        }
+        /* round the product to nearest and saturate it */
+        prod = (*pSrcCmplx++ * in + rnd) >> deciPoint;
+        *pDst++ = (prod > 0x7F) ? 0x7F : ((prod < -0x80) ? -0x80 : prod);
+#else
         if (even == 1) {
             in = *pSrcReal++;
             /* store result in destination buffer. */
@@ -95,6 +107,7 @@ void plp_cmplx_mult_real_q8_rv32im(const int8_t *__restrict__ pSrcCmplx,
         } else {
             *pDst++ = ((*pSrcCmplx++ * in)) >> deciPoint;
         }
+#endif
         even = !even;
         /* Decrement loop counter */
         blkCnt--;
@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_conj_f32_parallel.c
+ * Description:  Parallel floating-point complex conjugate glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_conj
+  @{
+ */
+
+/**
+  @brief         Glue code for parallel floating-point complex conjugate.
+  @param[in]     pSrc        points to input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_conj_f32_parallel(const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst,
+                                 uint32_t numSamples,
+                                 uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmplx_conj_instance_f32 S = { .pSrc = pSrc,
+                                          .pDst = pDst,
+                                          .numSamples = numSamples,
+                                          .nPE = nPE };
+
+        rt_team_fork(nPE, plp_cmplx_conj_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of cmplx_conj group
+ */
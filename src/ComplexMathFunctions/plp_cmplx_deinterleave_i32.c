@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_deinterleave_i32.c
+ * Description:  32-bit complex deinterleave glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxDeinterleave Complex Deinterleave
+  Splits an interleaved complex vector (real, imag, real, imag, ...) into a planar complex
+  vector, i.e. separate real and imaginary arrays.
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed. The source array has a total of <code>2*numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDstRe[n] = pSrc[(2*n)+0];
+      pDstIm[n] = pSrc[(2*n)+1];
+  }
+  </pre>
+  The functions only move data, use the 32- 16- 8-bit versions for fixed point and the 32-bit
+  version for floating point data as well.
+ */
+
+/**
+  @addtogroup CmplxDeinterleave
+  @{
+ */
+
+/**
+  @brief         Glue code for 32-bit complex deinterleave.
+  @param[in]     pSrc        points to the interleaved input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_deinterleave_i32(const int32_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pDstRe,
+                                int32_t *__restrict__ pDstIm,
+                                uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_deinterleave_i32s_rv32im(pSrc, pDstRe, pDstIm, numSamples);
+    } else {
+        plp_cmplx_deinterleave_i32s_xpulpv2(pSrc, pDstRe, pDstIm, numSamples);
+    }
+}
+
+/**
+  @} end of CmplxDeinterleave group
+ */
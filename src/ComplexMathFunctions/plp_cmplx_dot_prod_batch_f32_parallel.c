@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_batch_f32_parallel.c
+ * Description:  Parallel floating-point batched complex dot product glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_batch
+  @{
+ */
+
+/**
+  @brief         Glue code for parallel floating-point batched complex dot product.
+  @param[in]     pSrcA       points to the numVectors complex vectors, stored one after the other
+  @param[in]     pSrcB       points to the complex vector shared by all dot products
+  @param[in]     numVectors  number of vectors in pSrcA
+  @param[in]     numSamples  number of complex samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @param[out]    pDst        points to the numVectors complex results
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_batch_f32_parallel(const float32_t *__restrict__ pSrcA,
+                                           const float32_t *__restrict__ pSrcB,
+                                           uint32_t numVectors,
+                                           uint32_t numSamples,
+                                           uint32_t nPE,
+                                           float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmplx_dot_prod_batch_instance_f32 S = { .pSrcA = pSrcA,
+                                                    .pSrcB = pSrcB,
+                                                    .numVectors = numVectors,
+                                                    .numSamples = numSamples,
+                                                    .nPE = nPE,
+                                                    .pDst = pDst };
+
+        rt_team_fork(nPE, plp_cmplx_dot_prod_batch_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod_batch group
+ */
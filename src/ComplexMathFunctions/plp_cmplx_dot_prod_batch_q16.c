@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_batch_q16.c
+ * Description:  16-bit fixed-point batched complex dot product glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_dot_prod_batch Batched Complex Dot Product
+  Computes the dot products of many complex vectors with the same complex vector, as needed
+  e.g. to apply a set of beamforming weights or to scan a set of steering vectors.
+  The vectors of <code>pSrcA</code> are stored one after the other, each of them has
+  <code>numSamples</code> complex samples stored in an interleaved fashion
+  (real, imag, real, imag, ...). The results are stored interleaved in <code>pDst</code>.
+  The underlying algorithm is used:
+  <pre>
+  for (v = 0; v < numVectors; v++) {
+      pDst[(2*v)+0] = 0;
+      pDst[(2*v)+1] = 0;
+      for (n = 0; n < numSamples; n++) {
+          a = &pSrcA[2*numSamples*v];
+          pDst[(2*v)+0] += a[(2*n)+0] * pSrcB[(2*n)+0] - a[(2*n)+1] * pSrcB[(2*n)+1];
+          pDst[(2*v)+1] += a[(2*n)+0] * pSrcB[(2*n)+1] + a[(2*n)+1] * pSrcB[(2*n)+0];
+      }
+  }
+  </pre>
+  The kernels compute several dot products per pass over <code>pSrcB</code>, hence every
+  sample of <code>pSrcB</code> is loaded once for a block of vectors instead of once per vector.
+  In the fixed point versions the sums are accumulated at full precision (32-bit for q16,
+  64-bit for q32) and shifted right by <code>deciPoint</code> with rounding only once at the
+  end, as in plp_cmplx_dot_prod_planar.
+  The parallel versions distribute blocks of whole vectors over the cores, so no reduction of
+  partial sums is needed.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_batch
+  @{
+ */
+
+/**
+  @brief         Glue code for 16-bit fixed-point batched complex dot product.
+  @param[in]     pSrcA       points to the numVectors complex vectors, stored one after the other
+  @param[in]     pSrcB       points to the complex vector shared by all dot products
+  @param[in]     numVectors  number of vectors in pSrcA
+  @param[in]     numSamples  number of complex samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[out]    pDst        points to the numVectors complex results
+  @return        none
+  @par
+  The sign of the imaginary part of pSrcB is flipped inside packed operands, as in
+  plp_cmplx_mac_q16. An imaginary part of -32768 is clipped to -32767 before it is negated, which
+  changes the real part of the products by the imaginary part of pSrcA before the shift. Both
+  devices clip it, so they return identical results.
+ */
+
+void plp_cmplx_dot_prod_batch_q16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t numVectors,
+                                  uint32_t numSamples,
+                                  uint32_t deciPoint,
+                                  int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_dot_prod_batch_q16s_rv32im(pSrcA, pSrcB, numVectors, numSamples, deciPoint, pDst);
+    } else {
+        plp_cmplx_dot_prod_batch_q16s_xpulpv2(pSrcA, pSrcB, numVectors, numSamples, deciPoint,
+                                              pDst);
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod_batch group
+ */
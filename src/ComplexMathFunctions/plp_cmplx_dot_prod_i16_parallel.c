@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_i16_parallel.c
+ * Description:  Parallel 16-bit integer complex dot product glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod
+  @{
+ */
+
+/**
+  @brief         Glue code for parallel 16-bit integer complex dot product.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+  @par
+  Every core computes the partial sums of a contiguous block of complex samples, the partial
+  sums are added up after the team has finished. The result is identical to the one of the
+  single core version.
+ */
+
+void plp_cmplx_dot_prod_i16_parallel(const int16_t *pSrcA,
+                                     const int16_t *pSrcB,
+                                     uint32_t numSamples,
+                                     uint32_t nPE,
+                                     int16_t *realResult,
+                                     int16_t *imagResult) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        int16_t realBuffer[nPE];
+        int16_t imagBuffer[nPE];
+        int16_t realSum = 0, imagSum = 0;
+        uint32_t i;
+
+        plp_cmplx_dot_prod_instance_i16 S = { .pSrcA = pSrcA,
+                                              .pSrcB = pSrcB,
+                                              .numSamples = numSamples,
+                                              .nPE = nPE,
+                                              .realBuffer = realBuffer,
+                                              .imagBuffer = imagBuffer };
+
+        rt_team_fork(nPE, plp_cmplx_dot_prod_i16p_xpulpv2, (void *)&S);
+
+        for (i = 0; i < nPE; i++) {
+            realSum += realBuffer[i];
+            imagSum += imagBuffer[i];
+        }
+
+        *realResult = realSum;
+        *imagResult = imagSum;
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod group
+ */
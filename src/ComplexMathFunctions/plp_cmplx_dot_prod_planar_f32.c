@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_planar_f32.c
+ * Description:  Floating-point planar complex dot product glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_dot_prod_planar Planar Complex Dot Product
+  Computes the dot product of two complex vectors.
+  The vectors are multiplied element-by-element and then summed.
+  The real and imaginary parts are stored in separate arrays (planar or split format), as
+  delivered e.g. by separate I and Q DMA buffers, so no interleaving copy is needed.
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed.
+  The underlying algorithm is used:
+  <pre>
+  realResult = 0;
+  imagResult = 0;
+  for (n = 0; n < numSamples; n++) {
+      realResult += pSrcARe[n] * pSrcBRe[n] - pSrcAIm[n] * pSrcBIm[n];
+      imagResult += pSrcARe[n] * pSrcBIm[n] + pSrcAIm[n] * pSrcBRe[n];
+  }
+  </pre>
+  In the fixed point versions the sums are accumulated at full precision (32-bit for q16,
+  64-bit for q32) and shifted right by <code>deciPoint</code> with rounding only once at the
+  end, hence the results are more accurate than the ones of the interleaved functions, which
+  round every product.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_planar
+  @{
+ */
+
+/**
+  @brief         Glue code for floating-point planar complex dot product.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_planar_f32(const float32_t *pSrcARe,
+                                   const float32_t *pSrcAIm,
+                                   const float32_t *pSrcBRe,
+                                   const float32_t *pSrcBIm,
+                                   uint32_t numSamples,
+                                   float32_t *realResult,
+                                   float32_t *imagResult) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("error: FC doesn't have FPU\n");
+        return;
+    } else {
+        plp_cmplx_dot_prod_planar_f32s_xpulpv2(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, numSamples,
+                                               realResult, imagResult);
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod_planar group
+ */
@@ -0,0 +1,135 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_q32_parallel.c
+ * Description:  Parallel 32-bit fixed-point complex dot product glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod
+  @{
+ */
+
+/**
+  @brief         Glue code for parallel 32-bit fixed-point complex dot product.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     nPE         number of parallel processing units
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+  @par
+  Every core computes the partial sums of a contiguous block of complex samples, the partial
+  sums are added up after the team has finished. The result is identical to the one of the
+  single core version. With PLP_MATH_CMPLX_SATURATE, the partial sums are kept in 64 bits,
+  together with the number of times they overflowed, and the total is saturated once.
+ */
+
+void plp_cmplx_dot_prod_q32_parallel(const int32_t *pSrcA,
+                                     const int32_t *pSrcB,
+                                     uint32_t numSamples,
+                                     uint32_t deciPoint,
+                                     uint32_t nPE,
+                                     int32_t *realResult,
+                                     int32_t *imagResult) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        int64_t realBuffer[nPE];
+        int64_t imagBuffer[nPE];
+        int32_t realWraps[nPE];
+        int32_t imagWraps[nPE];
+        int64_t realSum = 0, imagSum = 0, sum;
+        int32_t realSumWraps = 0, imagSumWraps = 0;
+#else
+        int32_t realBuffer[nPE];
+        int32_t imagBuffer[nPE];
+        int32_t realSum = 0, imagSum = 0;
+#endif
+        uint32_t i;
+
+        plp_cmplx_dot_prod_instance_q32 S = { .pSrcA = pSrcA,
+                                              .pSrcB = pSrcB,
+                                              .numSamples = numSamples,
+                                              .deciPoint = deciPoint,
+                                              .nPE = nPE,
+#if defined(PLP_MATH_CMPLX_SATURATE)
+                                              .realWraps = realWraps,
+                                              .imagWraps = imagWraps,
+#endif
+                                              .realBuffer = realBuffer,
+                                              .imagBuffer = imagBuffer };
+
+        rt_team_fork(nPE, plp_cmplx_dot_prod_q32p_xpulpv2, (void *)&S);
+
+#if defined(PLP_MATH_CMPLX_SATURATE)
+        /* add up the 64-bit partial sums and all their overflows */
+        for (i = 0; i < nPE; i++) {
+            sum = (int64_t)((uint64_t)realSum + (uint64_t)realBuffer[i]);
+            realSumWraps += realWraps[i];
+            realSumWraps += (((realSum ^ sum) & (realBuffer[i] ^ sum)) < 0)
+                                ? ((realBuffer[i] < 0) ? -1 : 1)
+                                : 0;
+            realSum = sum;
+            sum = (int64_t)((uint64_t)imagSum + (uint64_t)imagBuffer[i]);
+            imagSumWraps += imagWraps[i];
+            imagSumWraps += (((imagSum ^ sum) & (imagBuffer[i] ^ sum)) < 0)
+                                ? ((imagBuffer[i] < 0) ? -1 : 1)
+                                : 0;
+            imagSum = sum;
+        }
+
+        /* saturate the total, a total that overflowed is beyond the output range */
+        realSum = (realSumWraps > 0 || realSum > 0x7FFFFFFF) ? 0x7FFFFFFF : realSum;
+        realSum = (realSumWraps < 0 || realSum < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : realSum;
+        *realResult = realSum;
+        imagSum = (imagSumWraps > 0 || imagSum > 0x7FFFFFFF) ? 0x7FFFFFFF : imagSum;
+        imagSum = (imagSumWraps < 0 || imagSum < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : imagSum;
+        *imagResult = imagSum;
+#else
+        for (i = 0; i < nPE; i++) {
+            realSum += realBuffer[i];
+            imagSum += imagBuffer[i];
+        }
+
+        *realResult = realSum;
+        *imagResult = imagSum;
+#endif
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_interleave_i32.c
+ * Description:  32-bit complex interleave glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxInterleave Complex Interleave
+  Merges a planar complex vector, i.e. separate real and imaginary arrays, into an interleaved
+  complex vector (real, imag, real, imag, ...) as used by the other complex functions.
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed. The destination array has a total of <code>2*numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)+0] = pSrcRe[n];
+      pDst[(2*n)+1] = pSrcIm[n];
+  }
+  </pre>
+  The functions only move data, use the 32- 16- 8-bit versions for fixed point and the 32-bit
+  version for floating point data as well.
+ */
+
+/**
+  @addtogroup CmplxInterleave
+  @{
+ */
+
+/**
+  @brief         Glue code for 32-bit complex interleave.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the interleaved output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_interleave_i32(const int32_t *__restrict__ pSrcRe,
+                              const int32_t *__restrict__ pSrcIm,
+                              int32_t *__restrict__ pDst,
+                              uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_interleave_i32s_rv32im(pSrcRe, pSrcIm, pDst, numSamples);
+    } else {
+        plp_cmplx_interleave_i32s_xpulpv2(pSrcRe, pSrcIm, pDst, numSamples);
+    }
+}
+
+/**
+  @} end of CmplxInterleave group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mac_q16.c
+ * Description:  16-bit fixed-point complex multiply-accumulate glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxMac Complex Multiply-Accumulate
+  Multiplies two complex vectors element-wise and adds the products to a complex accumulator
+  vector in a single pass, e.g. for frequency domain filter accumulation Acc += X * H.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed.  The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pAcc[(2*n)+0] += pSrcA[(2*n)+0] * pSrcB[(2*n)+0] - pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pAcc[(2*n)+1] += pSrcA[(2*n)+0] * pSrcB[(2*n)+1] + pSrcA[(2*n)+1] * pSrcB[(2*n)+0];
+  }
+  </pre>
+  In the fixed point versions both products are summed at full precision, the sum is shifted
+  right by <code>deciPoint</code> with rounding and added to the accumulator, which wraps around
+  on overflow like the other complex kernels.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup CmplxMac
+  @{
+ */
+
+/**
+  @brief         Glue code for 16-bit fixed-point complex multiply-accumulate.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+  @par
+  The products are computed with packed dot products, the sign of the imaginary part of pSrcB
+  is flipped inside the packed operand as in the CFFT kernels. An imaginary part of -32768 is
+  clipped to -32767 before it is negated. This changes the real part of the product by the imaginary part of
+  pSrcA before the shift, at most one LSB for deciPoint = 15. Both devices clip it, so they
+  return identical results.
+ */
+
+void plp_cmplx_mac_q16(const int16_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcB,
+                       int16_t *__restrict__ pAcc,
+                       uint32_t deciPoint,
+                       uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mac_q16s_rv32im(pSrcA, pSrcB, pAcc, deciPoint, numSamples);
+    } else {
+        plp_cmplx_mac_q16s_xpulpv2(pSrcA, pSrcB, pAcc, deciPoint, numSamples);
+    }
+}
+
+/**
+  @} end of CmplxMac group
+ */
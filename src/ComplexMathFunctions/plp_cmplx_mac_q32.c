@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mac_q32.c
+ * Description:  32-bit fixed-point complex multiply-accumulate glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxMac Complex Multiply-Accumulate
+  Multiplies two complex vectors element-wise and adds the products to a complex accumulator
+  vector in a single pass, e.g. for frequency domain filter accumulation Acc += X * H.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed.  The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pAcc[(2*n)+0] += pSrcA[(2*n)+0] * pSrcB[(2*n)+0] - pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pAcc[(2*n)+1] += pSrcA[(2*n)+0] * pSrcB[(2*n)+1] + pSrcA[(2*n)+1] * pSrcB[(2*n)+0];
+  }
+  </pre>
+  In the fixed point versions both products are summed at full precision, the sum is shifted
+  right by <code>deciPoint</code> with rounding and added to the accumulator, which wraps around
+  on overflow like the other complex kernels.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup CmplxMac
+  @{
+ */
+
+/**
+  @brief         Glue code for 32-bit fixed-point complex multiply-accumulate.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mac_q32(const int32_t *__restrict__ pSrcA,
+                       const int32_t *__restrict__ pSrcB,
+                       int32_t *__restrict__ pAcc,
+                       uint32_t deciPoint,
+                       uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mac_q32s_rv32im(pSrcA, pSrcB, pAcc, deciPoint, numSamples);
+    } else {
+        plp_cmplx_mac_q32s_xpulpv2(pSrcA, pSrcB, pAcc, deciPoint, numSamples);
+    }
+}
+
+/**
+  @} end of CmplxMac group
+ */
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_db_q16.c
+ * Description:  16-bit fixed-point complex magnitude in dB glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_db Complex Magnitude in Decibels
+  Computes the magnitude of the elements of a complex data vector in decibels, e.g. for a
+  spectrum display. The squared magnitude is computed at full precision as in
+  plp_cmplx_mag_squared and its logarithm is taken from a table of log2 with linear
+  interpolation, so no square root is needed.
+  The <code>pSrc</code> points to the source data and
+  <code>pRes</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pRes[n] = 10 * log10(pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2);
+  }
+  </pre>
+  The fixed point versions interpret the input with <code>fracBits</code> fractional bits,
+  i.e. 0 dB is a magnitude of 1.0, and return dB in Q8.8 (q16) or Q16.16 (q32). The maximum
+  error is 2e-4 dB plus the output resolution. A zero input returns the smallest output value.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag_db
+  @{
+ */
+
+/**
+  @brief         Glue code for 16-bit fixed-point complex magnitude in dB.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in]     fracBits    number of fractional bits of the input
+  @param[out]    pRes        points to the real output vector, dB in Q8.8
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_db_q16(const int16_t *__restrict__ pSrc,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes,
+                          uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mag_db_q16s_rv32im(pSrc, fracBits, pRes, numSamples);
+    } else {
+        plp_cmplx_mag_db_q16s_xpulpv2(pSrc, fracBits, pRes, numSamples);
+    }
+}
+
+/**
+  @} end of cmplx_mag_db group
+ */
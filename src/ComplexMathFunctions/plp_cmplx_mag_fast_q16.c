@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_fast_q16.c
+ * Description:  16-bit fixed-point fast approximate complex magnitude glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_fast Complex Magnitude Fast Approximation
+  Approximates the magnitude of the elements of a complex data vector without a square root,
+  using the alpha-max-plus-beta-min algorithm.
+  The <code>pSrc</code> points to the source data and
+  <code>pRes</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      mx = max(abs(pSrc[(2*n)+0]), abs(pSrc[(2*n)+1]));
+      mn = min(abs(pSrc[(2*n)+0]), abs(pSrc[(2*n)+1]));
+      pRes[n] = max over the segments s of (alpha[s] * mx + beta[s] * mn);
+  }
+  </pre>
+  The first octant is split into 1, 2 or 4 segments, selected by <code>accuracy</code>:
+  - PLP_CMPLX_MAG_FAST_LOW: 1 segment, maximum relative error 3.96 %
+  - PLP_CMPLX_MAG_FAST_MEDIUM: 2 segments, maximum relative error 0.97 %
+  - PLP_CMPLX_MAG_FAST_HIGH: 4 segments, maximum relative error 0.25 %
+  Larger values select PLP_CMPLX_MAG_FAST_HIGH. The output has the format of the input and is
+  saturated.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag_fast
+  @{
+ */
+
+/**
+  @brief         Glue code for 16-bit fixed-point fast approximate complex magnitude.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in]     accuracy    PLP_CMPLX_MAG_FAST_LOW, _MEDIUM or _HIGH
+  @param[out]    pRes        points to the real output vector
+  @param[in]     numSamples  number of samples in the input vector
+  @return        none
+ */
+
+void plp_cmplx_mag_fast_q16(const int16_t *__restrict__ pSrc,
+                            uint32_t accuracy,
+                            int16_t *__restrict__ pRes,
+                            uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mag_fast_q16s_rv32im(pSrc, accuracy, pRes, numSamples);
+    } else {
+        plp_cmplx_mag_fast_q16s_xpulpv2(pSrc, accuracy, pRes, numSamples);
+    }
+}
+
+/**
+  @} end of cmplx_mag_fast group
+ */
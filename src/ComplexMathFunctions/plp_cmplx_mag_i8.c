@@ -76,8 +76,6 @@
 void plp_cmplx_mag_i8(const int8_t *pSrc,
                       int8_t *pRes,
                       uint32_t numSamples){
-    printf("Error: plp_sqrt_q8 not implemented!\n");
-    return;
     if (rt_cluster_id() == ARCHI_FC_CID){
         plp_cmplx_mag_i8s_rv32im(pSrc, pRes, numSamples);
     }
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_planar_q32.c
+ * Description:  32-bit fixed-point planar complex squared magnitude glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_squared_planar Planar Complex Magnitude Squared
+  Computes the magnitude squared of the elements of a complex data vector.
+  The real and imaginary parts are stored in separate arrays (planar or split format), as
+  delivered e.g. by separate I and Q DMA buffers, so no interleaving copy is needed.
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[n] = pSrcRe[n]^2 + pSrcIm[n]^2;
+  }
+  </pre>
+  In the fixed point versions the products are summed at full precision and the sum is
+  shifted right by <code>deciPoint</code> with rounding, hence the results may differ by one
+  LSB from the interleaved functions, which round every product.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_planar
+  @{
+ */
+
+/**
+  @brief         Glue code for 32-bit fixed-point planar complex squared magnitude.
+  @param[in]     pSrcRe      points to the real parts of the input vector
+  @param[in]     pSrcIm      points to the imaginary parts of the input vector
+  @param[out]    pDst        points to the real output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_planar_q32(const int32_t *__restrict__ pSrcRe,
+                                      const int32_t *__restrict__ pSrcIm,
+                                      int32_t *__restrict__ pDst,
+                                      uint32_t deciPoint,
+                                      uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mag_squared_planar_q32s_rv32im(pSrcRe, pSrcIm, pDst, deciPoint, numSamples);
+    } else {
+        plp_cmplx_mag_squared_planar_q32s_xpulpv2(pSrcRe, pSrcIm, pDst, deciPoint, numSamples);
+    }
+}
+
+/**
+  @} end of cmplx_mag_squared_planar group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_cmplx_i8_parallel.c
+ * Description:  Parallel 8-bit integer complex-by-complex multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxByCmplxMult
+  @{
+ */
+
+/**
+  @brief         Glue code for parallel 8-bit integer complex-by-complex multiplication.
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      int8_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmplx_mult_cmplx_instance_i8 S = { .pSrcA = pSrcA,
+                                               .pSrcB = pSrcB,
+                                               .pDst = pDst,
+                                               .numSamples = numSamples,
+                                               .nPE = nPE };
+
+        rt_team_fork(nPE, plp_cmplx_mult_cmplx_i8p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of CmplxByCmplxMult group
+ */
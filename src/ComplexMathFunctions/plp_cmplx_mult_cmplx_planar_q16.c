@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_cmplx_planar_q16.c
+ * Description:  16-bit fixed-point planar complex-by-complex multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByCmplxMultPlanar Planar Complex-by-Complex Multiplication
+  Multiplies a complex vector by another complex vector and generates a complex result.
+  The real and imaginary parts are stored in separate arrays (planar or split format), as
+  delivered e.g. by separate I and Q DMA buffers, so no interleaving copy is needed.
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDstRe[n] = pSrcARe[n] * pSrcBRe[n] - pSrcAIm[n] * pSrcBIm[n];
+      pDstIm[n] = pSrcARe[n] * pSrcBIm[n] + pSrcAIm[n] * pSrcBRe[n];
+  }
+  </pre>
+  In the fixed point versions the products are summed at full precision and the sum is
+  shifted right by <code>deciPoint</code> with rounding, hence the results may differ by one
+  LSB from the interleaved functions, which round every product.
+  There are separate functions for floating point and fixed point 32- 16-bit data types.
+ */
+
+/**
+  @addtogroup CmplxByCmplxMultPlanar
+  @{
+ */
+
+/**
+  @brief         Glue code for 16-bit fixed-point planar complex-by-complex multiplication.
+  @param[in]     pSrcARe     points to the real parts of the first input vector
+  @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+  @param[in]     pSrcBRe     points to the real parts of the second input vector
+  @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+  @param[out]    pDstRe      points to the real parts of the output vector
+  @param[out]    pDstIm      points to the imaginary parts of the output vector
+  @param[in]     deciPoint   decimal point for right shift
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+  @par
+  The products are computed with packed dot products on pairs of samples, the sign of the
+  imaginary part of pSrcB is flipped inside the packed operand as in plp_cmplx_mult_conj_q16.
+  An imaginary part of -32768 is clipped to -32767 before it is negated, which changes the real
+  part of the product by the imaginary part of pSrcA before the shift. The odd last sample and
+  the RV32IM kernel clip it as well, so every sample is treated the same on both devices.
+ */
+
+void plp_cmplx_mult_cmplx_planar_q16(const int16_t *__restrict__ pSrcARe,
+                                     const int16_t *__restrict__ pSrcAIm,
+                                     const int16_t *__restrict__ pSrcBRe,
+                                     const int16_t *__restrict__ pSrcBIm,
+                                     int16_t *__restrict__ pDstRe,
+                                     int16_t *__restrict__ pDstIm,
+                                     uint32_t deciPoint,
+                                     uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mult_cmplx_planar_q16s_rv32im(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm,
+                                                deciPoint, numSamples);
+    } else {
+        plp_cmplx_mult_cmplx_planar_q16s_xpulpv2(pSrcARe, pSrcAIm, pSrcBRe, pSrcBIm, pDstRe, pDstIm,
+                                                 deciPoint, numSamples);
+    }
+}
+
+/**
+  @} end of CmplxByCmplxMultPlanar group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_real_i16_parallel.c
+ * Description:  Parallel 16-bit integer complex-by-real multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup CmplxByRealMult
+  @{
+ */
+
+/**
+  @brief         Glue code for parallel 16-bit integer complex-by-real multiplication.
+  @param[in]     pSrcCmplx   points to complex input vector
+  @param[in]     pSrcReal    points to real input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mult_real_i16_parallel(const int16_t *__restrict__ pSrcCmplx,
+                                      const int16_t *__restrict__ pSrcReal,
+                                      int16_t *__restrict__ pDst,
+                                      uint32_t numSamples,
+                                      uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmplx_mult_real_instance_i16 S = { .pSrcCmplx = pSrcCmplx,
+                                               .pSrcReal = pSrcReal,
+                                               .pDst = pDst,
+                                               .numSamples = numSamples,
+                                               .nPE = nPE };
+
+        rt_team_fork(nPE, plp_cmplx_mult_real_i16p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of CmplxByRealMult group
+ */
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_f32s_xpulpv2.c
+ * Description:  f32 vector four quadrant arctangent function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 four quadrant arctangent of one sample, atan of the ratio min / max in [0, 1]
+ *             from a linear interpolation of atanTable_f32, unfolded to the octant of (x, y)
+ *
+ * @param[in]  y     imaginary part or ordinate
+ * @param[in]  x     real part or abscissa
+ *
+ * @return     atan2(y, x) in radians
+ */
+static inline float32_t plp_atan2_elem_f32(float32_t y, float32_t x) {
+    float32_t ax = (x < 0.0f) ? -x : x;
+    float32_t ay = (y < 0.0f) ? -y : y;
+    float32_t t, v;
+    int32_t i;
+
+    if (ax == 0.0f && ay == 0.0f) {
+        return 0.0f;
+    }
+
+    t = ((ay <= ax) ? ay / ax : ax / ay) * FAST_MATH_ATAN_TABLE_SIZE;
+    i = (int32_t)t;
+    v = atanTable_f32[i];
+    if (i < FAST_MATH_ATAN_TABLE_SIZE) {
+        v += (t - (float32_t)i) * (atanTable_f32[i + 1] - v);
+    }
+
+    // unfold the octant
+    if (ay > ax) {
+        v = 1.57079633f - v;
+    }
+    if (x < 0.0f) {
+        v = 3.14159265f - v;
+    }
+    return (y < 0.0f) ? -v : v;
+}
+
+/**
+ * @brief      f32 vector four quadrant arctangent function for XPULPV2
+ *
+ * @param[in]   pSrcY      points to the ordinates (imaginary parts)
+ * @param[in]   pSrcX      points to the abscissas (real parts)
+ * @param[in]   blockSize  number of samples in input vectors
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_atan2_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrcY,
+                                const float32_t *__restrict__ pSrcX,
+                                uint32_t blockSize,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_atan2_elem_f32(pSrcY[blkCnt], pSrcX[blkCnt]);
+        pDst[blkCnt + 1] = plp_atan2_elem_f32(pSrcY[blkCnt + 1], pSrcX[blkCnt + 1]);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_atan2_elem_f32(pSrcY[blkCnt], pSrcX[blkCnt]);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_atan2_elem_f32(pSrcY[blkCnt], pSrcX[blkCnt]);
+    }
+
+#endif
+}
@@ -0,0 +1,124 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_q16s_xpulpv2.c
+ * Description:  q16 vector four quadrant arctangent function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 four quadrant arctangent of one sample, atan of the ratio min / max in [0, 1]
+ *             from a linear interpolation of atanTable_q32, unfolded to the octant of (x, y)
+ *
+ * @param[in]  y     imaginary part or ordinate
+ * @param[in]  x     real part or abscissa
+ *
+ * @return     atan2(y, x) / (2 * PI) in Q1.31, i.e. in turns within [-0.5, 0.5]
+ */
+static inline int32_t plp_atan2_elem_q32(int32_t y, int32_t x) {
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t ay = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+    uint32_t t, i, s;
+    int32_t v;
+
+    if (ax == 0U && ay == 0U) {
+        return 0;
+    }
+
+    // t = min / max in UQ1.31, i.e. in [0, 2^31]
+    if (ay <= ax) {
+        t = ((uint64_t)ay << 31) / ax;
+    } else {
+        t = ((uint64_t)ax << 31) / ay;
+    }
+
+    i = t >> (31U - FAST_MATH_ATAN_TABLE_BITS);
+    s = t & ((1U << (31U - FAST_MATH_ATAN_TABLE_BITS)) - 1U);
+    v = atanTable_q32[i];
+    if (s != 0U) {
+        v += ((int64_t)(atanTable_q32[i + 1] - v) * s) >> (31U - FAST_MATH_ATAN_TABLE_BITS);
+    }
+
+    // unfold the octant, a quarter turn is 2^29
+    if (ay > ax) {
+        v = (1 << 29) - v;
+    }
+    if (x < 0) {
+        v = (1 << 30) - v;
+    }
+    return (y < 0) ? -v : v;
+}
+
+/**
+ * @brief      q16 four quadrant arctangent of one sample, computed at q32 precision
+ *
+ * @param[in]  y     imaginary part or ordinate
+ * @param[in]  x     real part or abscissa
+ *
+ * @return     atan2(y, x) / (2 * PI) in Q1.15, i.e. in turns within [-0.5, 0.5]
+ */
+static inline int16_t plp_atan2_elem_q16(int16_t y, int16_t x) {
+    return ((plp_atan2_elem_q32(y, x) >> 15) + 1) >> 1;
+}
+
+/**
+ * @brief      q16 vector four quadrant arctangent function for XPULPV2
+ *
+ * @param[in]   pSrcY      points to the ordinates (imaginary parts)
+ * @param[in]   pSrcX      points to the abscissas (real parts)
+ * @param[in]   blockSize  number of samples in input vectors
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_atan2_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrcY,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t blockSize,
+                                int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_atan2_elem_q16(pSrcY[blkCnt], pSrcX[blkCnt]);
+        pDst[blkCnt + 1] = plp_atan2_elem_q16(pSrcY[blkCnt + 1], pSrcX[blkCnt + 1]);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_atan2_elem_q16(pSrcY[blkCnt], pSrcX[blkCnt]);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_atan2_elem_q16(pSrcY[blkCnt], pSrcX[blkCnt]);
+    }
+
+#endif
+}
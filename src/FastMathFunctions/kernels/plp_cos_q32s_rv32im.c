@@ -60,11 +60,11 @@ int32_t plp_cos_q32s_rv32im(int32_t x) {
     index = (uint32_t)x >> FAST_MATH_Q32_SHIFT;
 
     /* Calculation of fractional value */
-    fract = (x - (index << FAST_MATH_Q32_SHIFT)) << 9;
+    fract = (x - (index << FAST_MATH_Q32_SHIFT)) << PLP_FAST_MATH_TABLE_BITS;
 
     /* Read two nearest values of input value from the sin table */
-    a = sinTable_q32[index];
-    b = sinTable_q32[index + 1];
+    a = plp_sin_table_q32(index);
+    b = plp_sin_table_q32(index + 1);
 
     /* Linear interpolation process */
     cosVal = (int64_t)(0x80000000 - fract) * a >> 32;
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_f32s_xpulpv2.c
+ * Description:  Calculates the cosine of a f32 vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 vector cosine function for XPULPV2
+ *
+ * @param[in]   pSrc      points to the input vector, values in radians
+ * @param[in]   blockSize number of samples in input vector
+ * @param[out]  pDst      points to the cosine output vector
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    float32_t in, findex, fract;
+    uint32_t index;
+    int32_t n;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        in = pSrc[blkCnt] * 0.159154943092f + 0.25f;
+        n = (int32_t)in;
+        if (in < 0.0f) {
+            n--;
+        }
+        in = in - (float32_t)n;
+        findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+        index = (uint32_t)findex;
+        if (index >= FAST_MATH_TABLE_SIZE) {
+            index = 0;
+            findex -= (float32_t)FAST_MATH_TABLE_SIZE;
+        }
+        fract = findex - (float32_t)index;
+        pDst[blkCnt] = plp_sin_interp_f32(index, fract);
+    }
+}
@@ -0,0 +1,60 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_q32s_rv32im.c
+ * Description:  Calculates the cosine of a q32 vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 vector cosine function for RV32IM
+ *
+ * @param[in]   pSrc      points to the input vector, Q1.31 values, [-1, 1) mapped to [-2*PI, 2*PI)
+ * @param[in]   blockSize number of samples in input vector
+ * @param[out]  pDst      points to the cosine output vector
+ *
+ * @note       The interpolation is computed at full output precision with a single rounding
+ *             step, results may differ by up to 3 LSB from plp_sin_q32 / plp_cos_q32.
+ *
+ * @return     none
+ */
+
+void plp_cos_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    uint32_t xp, index;
+    int32_t fract;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        xp = (uint32_t)pSrc[blkCnt] & 0x7FFFFFFFU;
+        index = xp >> FAST_MATH_Q32_SHIFT;
+        fract = (xp & ((1U << FAST_MATH_Q32_SHIFT) - 1)) << (31 - FAST_MATH_Q32_SHIFT);
+        index = (index + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+        pDst[blkCnt] = plp_sin_interp_q32(index, fract);
+    }
+}
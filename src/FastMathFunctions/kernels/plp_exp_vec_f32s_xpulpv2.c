@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_vec_f32s_xpulpv2.c
+ * Description:  f32 vector exponential function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 exponential of one sample, exp(x) = 2^n * 2^(i / 32) * 2^r with a table for
+ *             2^(i / 32) and a cubic polynomial for the remainder 2^r, r < 1 / 32
+ *
+ * @param[in]  x     input value
+ *
+ * @return     exp(x), the largest float on overflow and 0 below the normal range
+ */
+static inline float32_t plp_exp_elem_f32(float32_t x) {
+    float32_t z = x * 1.44269504f;
+    float32_t u, a, v;
+    int32_t n, i;
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    if (z >= 128.0f) {
+        return 3.402823466e+38f;
+    }
+    if (z < -126.0f) {
+        return 0.0f;
+    }
+
+    n = (int32_t)z;
+    if ((float32_t)n > z) {
+        n--;
+    }
+    u = (z - (float32_t)n) * FAST_MATH_EXP_TABLE_SIZE;
+    i = (int32_t)u;
+
+    // 2^r = exp(a) with a = r * ln(2), Taylor series up to a^3
+    a = (u - (float32_t)i) * (0.693147181f / FAST_MATH_EXP_TABLE_SIZE);
+    v = 1.0f + a * (1.0f + a * (0.5f + a * (1.0f / 6.0f)));
+
+    // 2^n from the exponent bits
+    conv.i = (n + 127) << 23;
+    return exp2Table_f32[i] * v * conv.f;
+}
+
+/**
+ * @brief      f32 vector exponential function for XPULPV2
+ *
+ * @param[in]   pSrc       points to the input vector
+ * @param[in]   blockSize  number of samples in input vector
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_exp_elem_f32(pSrc[blkCnt]);
+        pDst[blkCnt + 1] = plp_exp_elem_f32(pSrc[blkCnt + 1]);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_exp_elem_f32(pSrc[blkCnt]);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_exp_elem_f32(pSrc[blkCnt]);
+    }
+
+#endif
+}
@@ -0,0 +1,131 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_vec_q16s_xpulpv2.c
+ * Description:  q16 vector exponential function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 exponential of one sample, exp(x) = 2^n * 2^(i / 32) * 2^r with a table for
+ *             2^(i / 32) and a cubic polynomial for the remainder 2^r, r < 1 / 32
+ *
+ * @param[in]  x         input value
+ * @param[in]  fracBits  number of fractional bits of input and output
+ *
+ * @return     exp(x) in the format of x, saturated
+ */
+static inline int32_t plp_exp_elem_q32(int32_t x, uint32_t fracBits) {
+    // z = x * log2(e) in Q(fracBits + 30), split into integer n and fraction u in Q1.31
+    int64_t z = (int64_t)x * PLP_LOG2E_Q30;
+    int64_t n = z >> (fracBits + 30U);
+    uint32_t u = (fracBits > 0U) ? (uint32_t)(z >> (fracBits - 1U)) : (uint32_t)z << 1;
+    uint32_t i, a, a2, a3, v;
+    int32_t sh;
+
+    if (n > 31) {
+        return 0x7FFFFFFF;
+    }
+    if (n < -64) {
+        return 0;
+    }
+
+    u &= 0x7FFFFFFFU;
+    i = u >> (31U - FAST_MATH_EXP_TABLE_BITS);
+
+    // 2^r = exp(a) with a = r * ln(2), Taylor series up to a^3 in Q1.31
+    a = ((uint64_t)(u & ((1U << (31U - FAST_MATH_EXP_TABLE_BITS)) - 1U)) * PLP_LN2_Q31) >> 31;
+    a2 = ((uint64_t)a * a) >> 31;
+    a3 = ((uint64_t)a2 * a) >> 31;
+    v = (1U << 30) + ((a + (a2 >> 1) + a3 / 6U) >> 1);
+    v = ((uint64_t)exp2Table_q32[i] * v + (1U << 29)) >> 30;
+
+    // exp(x) = v * 2^(n - 30) with v in [2^30, 2^31]
+    sh = (int32_t)n + (int32_t)fracBits - 30;
+    if (sh >= 0) {
+        if (sh > 0 || v > 0x7FFFFFFFU) {
+            return 0x7FFFFFFF;
+        }
+        return (int32_t)v;
+    }
+    if (sh < -31) {
+        return 0;
+    }
+    return (int32_t)((v + (1U << (-sh - 1))) >> (-sh));
+}
+
+/**
+ * @brief      q16 exponential of one sample, computed at q32 precision
+ *
+ * @param[in]  x         input value
+ * @param[in]  fracBits  number of fractional bits of input and output
+ *
+ * @return     exp(x) in the format of x, saturated
+ */
+static inline int16_t plp_exp_elem_q16(int16_t x, uint32_t fracBits) {
+    int32_t r = plp_exp_elem_q32(x, fracBits);
+
+    return (r > 0x7FFF) ? 0x7FFF : r;
+}
+
+/**
+ * @brief      q16 vector exponential function for XPULPV2
+ *
+ * @param[in]   pSrc       points to the input vector
+ * @param[in]   blockSize  number of samples in input vector
+ * @param[in]   fracBits   number of fractional bits of input and output
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_exp_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_exp_elem_q16(pSrc[blkCnt], fracBits);
+        pDst[blkCnt + 1] = plp_exp_elem_q16(pSrc[blkCnt + 1], fracBits);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_exp_elem_q16(pSrc[blkCnt], fracBits);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_exp_elem_q16(pSrc[blkCnt], fracBits);
+    }
+
+#endif
+}
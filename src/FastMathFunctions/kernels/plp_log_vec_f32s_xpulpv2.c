@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log_vec_f32s_xpulpv2.c
+ * Description:  f32 vector natural logarithm function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 natural logarithm of one sample, the mantissa m in [1, 2) is split into
+ *             (1 + i / 32) * (1 + d), ln(1 + i / 32) comes from a table and ln(1 + d) from a
+ *             polynomial of degree 4 in d < 1 / 32
+ *
+ * @param[in]  x     input value, denormals are not supported
+ *
+ * @return     ln(x), the smallest float for x <= 0
+ */
+static inline float32_t plp_log_elem_f32(float32_t x) {
+    float32_t d;
+    int32_t e, i;
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    if (x <= 0.0f) {
+        return -3.402823466e+38f;
+    }
+
+    // x = m * 2^e, the table index are the top mantissa bits
+    conv.f = x;
+    e = ((conv.i >> 23) & 0xFF) - 127;
+    i = (conv.i >> (23 - FAST_MATH_LOG_TABLE_BITS)) & (FAST_MATH_LOG_TABLE_SIZE - 1);
+    conv.i = (conv.i & 0x007FFFFF) | 0x3F800000;
+
+    d = conv.f * recipTable_f32[i] - 1.0f;
+    d = d * (1.0f - d * (0.5f - d * (1.0f / 3.0f - d * 0.25f)));
+    return (float32_t)e * 0.693147181f + logTable_f32[i] + d;
+}
+
+/**
+ * @brief      f32 vector natural logarithm function for XPULPV2
+ *
+ * @param[in]   pSrc       points to the input vector
+ * @param[in]   blockSize  number of samples in input vector
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_log_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_log_elem_f32(pSrc[blkCnt]);
+        pDst[blkCnt + 1] = plp_log_elem_f32(pSrc[blkCnt + 1]);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_log_elem_f32(pSrc[blkCnt]);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_log_elem_f32(pSrc[blkCnt]);
+    }
+
+#endif
+}
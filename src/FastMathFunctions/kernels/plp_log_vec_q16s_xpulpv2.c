@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log_vec_q16s_xpulpv2.c
+ * Description:  q16 vector natural logarithm function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 natural logarithm of one sample, the mantissa m in [1, 2) is split into
+ *             (1 + i / 32) * (1 + d), ln(1 + i / 32) comes from a table and ln(1 + d) from a
+ *             polynomial of degree 4 in d < 1 / 32
+ *
+ * @param[in]  x         input value
+ * @param[in]  fracBits  number of fractional bits of input and output
+ *
+ * @return     ln(x) in the format of x, saturated, the smallest value for x <= 0
+ */
+static inline int32_t plp_log_elem_q32(int32_t x, uint32_t fracBits) {
+    uint32_t lead, m, i;
+    int32_t e, d, d2, d3, d4;
+    int64_t l;
+
+    if (x <= 0) {
+        return (int32_t)0x80000000;
+    }
+
+    // x = m * 2^e with the mantissa m in [1, 2) as UQ1.31
+    lead = __builtin_clz((uint32_t)x);
+    m = (uint32_t)x << lead;
+    e = 31 - (int32_t)lead - (int32_t)fracBits;
+
+    // d = m / (1 + i / 32) - 1 in Q2.30, slightly negative values come from table rounding
+    i = (m >> (31U - FAST_MATH_LOG_TABLE_BITS)) & (FAST_MATH_LOG_TABLE_SIZE - 1U);
+    d = (int32_t)((((uint64_t)m * (uint32_t)recipTable_q32[i]) >> 31) - (1U << 30));
+    d2 = ((int64_t)d * d) >> 30;
+    d3 = ((int64_t)d2 * d) >> 30;
+    d4 = ((int64_t)d3 * d) >> 30;
+
+    // ln(x) = e * ln(2) + ln(1 + i / 32) + ln(1 + d), all in Q2.30
+    l = (int64_t)e * PLP_LN2_Q30 + logTable_q32[i] + d - (d2 >> 1) + d3 / 3 - (d4 >> 2);
+
+    if (fracBits < 30U) {
+        l = (l + (1 << (29U - fracBits))) >> (30U - fracBits);
+    } else {
+        l *= (int64_t)1 << (fracBits - 30U);
+    }
+    if (l > 0x7FFFFFFF) {
+        return 0x7FFFFFFF;
+    }
+    if (l < -0x7FFFFFFF - 1) {
+        return (int32_t)0x80000000;
+    }
+    return (int32_t)l;
+}
+
+/**
+ * @brief      q16 natural logarithm of one sample, computed at q32 precision
+ *
+ * @param[in]  x         input value
+ * @param[in]  fracBits  number of fractional bits of input and output
+ *
+ * @return     ln(x) in the format of x, saturated, the smallest value for x <= 0
+ */
+static inline int16_t plp_log_elem_q16(int16_t x, uint32_t fracBits) {
+    int32_t r = plp_log_elem_q32(x, fracBits);
+
+    if (r > 0x7FFF) {
+        return 0x7FFF;
+    }
+    return (r < -0x8000) ? -0x8000 : r;
+}
+
+/**
+ * @brief      q16 vector natural logarithm function for XPULPV2
+ *
+ * @param[in]   pSrc       points to the input vector
+ * @param[in]   blockSize  number of samples in input vector
+ * @param[in]   fracBits   number of fractional bits of input and output
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_log_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_log_elem_q16(pSrc[blkCnt], fracBits);
+        pDst[blkCnt + 1] = plp_log_elem_q16(pSrc[blkCnt + 1], fracBits);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_log_elem_q16(pSrc[blkCnt], fracBits);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_log_elem_q16(pSrc[blkCnt], fracBits);
+    }
+
+#endif
+}
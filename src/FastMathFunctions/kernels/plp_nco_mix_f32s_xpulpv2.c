@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_mix_f32s_xpulpv2.c
+ * Description:  f32 numerically controlled oscillator complex mixing for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 numerically controlled oscillator complex mixing for XPULPV2
+ *
+ * @param[in,out] S         points to an instance of the NCO structure
+ * @param[in]     pSrc      points to the 32-bit float complex input vector
+ * @param[in]     blockSize number of complex samples
+ * @param[out]    pDst      points to the 32-bit float complex output vector
+ *
+ * @note       Every input sample is multiplied by exp(j * phase), the oscillator is never stored.
+ *             Use a negative (two's complement) phase increment to shift down.
+ *
+ * @return     none
+ */
+
+void plp_nco_mix_f32s_xpulpv2(plp_nco_instance_f32 *S,
+                              const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t phase = S->phase;
+    uint32_t phaseInc = S->phaseInc;
+    uint32_t blkCnt;
+    float32_t c, s;
+#if defined(PLP_MATH_LOOPUNROLL)
+    float32_t c1, s1;
+#endif
+    float32_t re, im;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        plp_nco_lookup_f32(phase, &c, &s);
+        plp_nco_lookup_f32(phase + phaseInc, &c1, &s1);
+        phase += 2 * phaseInc;
+        re = *pSrc++;
+        im = *pSrc++;
+        *pDst++ = re * c - im * s;
+        *pDst++ = re * s + im * c;
+        re = *pSrc++;
+        im = *pSrc++;
+        *pDst++ = re * c1 - im * s1;
+        *pDst++ = re * s1 + im * c1;
+    }
+
+    if (blockSize % 2 == 1) {
+        plp_nco_lookup_f32(phase, &c, &s);
+        phase += phaseInc;
+        re = *pSrc++;
+        im = *pSrc++;
+        *pDst++ = re * c - im * s;
+        *pDst++ = re * s + im * c;
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        plp_nco_lookup_f32(phase, &c, &s);
+        phase += phaseInc;
+        re = *pSrc++;
+        im = *pSrc++;
+        *pDst++ = re * c - im * s;
+        *pDst++ = re * s + im * c;
+    }
+
+#endif
+
+    S->phase = phase;
+}
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_mix_q16s_rv32im.c
+ * Description:  q16 numerically controlled oscillator complex mixing for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 numerically controlled oscillator complex mixing for RV32IM
+ *
+ * @param[in,out] S         points to an instance of the NCO structure
+ * @param[in]     pSrc      points to the Q1.15 complex input vector
+ * @param[in]     blockSize number of complex samples
+ * @param[out]    pDst      points to the Q1.15 complex output vector
+ *
+ * @note       Every input sample is multiplied by exp(j * phase), the oscillator is never stored.
+ *             Use a negative (two's complement) phase increment to shift down.
+ *             The outputs are saturated, since the interpolated oscillator can exceed 1 slightly.
+ *
+ * @return     none
+ */
+
+void plp_nco_mix_q16s_rv32im(plp_nco_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDst) {
+
+    uint32_t phase = S->phase;
+    uint32_t phaseInc = S->phaseInc;
+    uint32_t blkCnt;
+    int16_t c, s;
+    int16_t re, im;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        plp_nco_lookup_q16(phase, &c, &s);
+        phase += phaseInc;
+        re = *pSrc++;
+        im = *pSrc++;
+        *pDst++ = __CLIP((re * c - im * s + 0x4000) >> 15, 15);
+        *pDst++ = __CLIP((re * s + im * c + 0x4000) >> 15, 15);
+    }
+
+    S->phase = phase;
+}
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_mix_q16s_xpulpv2.c
+ * Description:  q16 numerically controlled oscillator complex mixing for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 numerically controlled oscillator complex mixing for XPULPV2
+ *
+ * @param[in,out] S         points to an instance of the NCO structure
+ * @param[in]     pSrc      points to the Q1.15 complex input vector
+ * @param[in]     blockSize number of complex samples
+ * @param[out]    pDst      points to the Q1.15 complex output vector
+ *
+ * @note       Every input sample is multiplied by exp(j * phase), the oscillator is never stored.
+ *             Use a negative (two's complement) phase increment to shift down.
+ *             The outputs are saturated, since the interpolated oscillator can exceed 1 slightly.
+ *
+ * @return     none
+ */
+
+void plp_nco_mix_q16s_xpulpv2(plp_nco_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t phase = S->phase;
+    uint32_t phaseInc = S->phaseInc;
+    uint32_t blkCnt;
+    int16_t c, s;
+#if defined(PLP_MATH_LOOPUNROLL)
+    int16_t c1, s1;
+#endif
+    v2s x;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        plp_nco_lookup_q16(phase, &c, &s);
+        plp_nco_lookup_q16(phase + phaseInc, &c1, &s1);
+        phase += 2 * phaseInc;
+        x = *((v2s *)pSrc);
+        *((v2s *)pDst) = (v2s){ __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ c, -s })), 15), 15),
+                                __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ s, c })), 15), 15) };
+        pSrc += 2;
+        pDst += 2;
+        x = *((v2s *)pSrc);
+        *((v2s *)pDst) = (v2s){ __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ c1, -s1 })), 15), 15),
+                                __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ s1, c1 })), 15), 15) };
+        pSrc += 2;
+        pDst += 2;
+    }
+
+    if (blockSize % 2 == 1) {
+        plp_nco_lookup_q16(phase, &c, &s);
+        phase += phaseInc;
+        x = *((v2s *)pSrc);
+        *((v2s *)pDst) = (v2s){ __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ c, -s })), 15), 15),
+                                __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ s, c })), 15), 15) };
+        pSrc += 2;
+        pDst += 2;
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        plp_nco_lookup_q16(phase, &c, &s);
+        phase += phaseInc;
+        x = *((v2s *)pSrc);
+        *((v2s *)pDst) = (v2s){ __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ c, -s })), 15), 15),
+                                __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ s, c })), 15), 15) };
+        pSrc += 2;
+        pDst += 2;
+    }
+
+#endif
+
+    S->phase = phase;
+}
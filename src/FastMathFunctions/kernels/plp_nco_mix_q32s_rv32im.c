@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_mix_q32s_rv32im.c
+ * Description:  q32 numerically controlled oscillator complex mixing for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 numerically controlled oscillator complex mixing for RV32IM
+ *
+ * @param[in,out] S         points to an instance of the NCO structure
+ * @param[in]     pSrc      points to the Q1.31 complex input vector
+ * @param[in]     blockSize number of complex samples
+ * @param[out]    pDst      points to the Q1.31 complex output vector
+ *
+ * @note       Every input sample is multiplied by exp(j * phase), the oscillator is never stored.
+ *             Use a negative (two's complement) phase increment to shift down.
+ *             The outputs are saturated, since the interpolated oscillator can exceed 1 slightly.
+ *
+ * @return     none
+ */
+
+void plp_nco_mix_q32s_rv32im(plp_nco_instance_q32 *S,
+                             const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst) {
+
+    uint32_t phase = S->phase;
+    uint32_t phaseInc = S->phaseInc;
+    uint32_t blkCnt;
+    int32_t c, s;
+    int32_t re, im;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        plp_nco_lookup_q32(phase, &c, &s);
+        phase += phaseInc;
+        re = *pSrc++;
+        im = *pSrc++;
+        *pDst++ = plp_nco_round_sat_q32((int64_t)re * c - (int64_t)im * s);
+        *pDst++ = plp_nco_round_sat_q32((int64_t)re * s + (int64_t)im * c);
+    }
+
+    S->phase = phase;
+}
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_q32s_xpulpv2.c
+ * Description:  q32 numerically controlled oscillator complex exponential generation for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 numerically controlled oscillator complex exponential generation for XPULPV2
+ *
+ * @param[in,out] S         points to an instance of the NCO structure
+ * @param[in]     blockSize number of complex samples to generate
+ * @param[out]    pDst      points to the Q1.31 complex output (cos, sin, cos, sin, ...)
+ *
+ * @return     none
+ */
+
+void plp_nco_q32s_xpulpv2(plp_nco_instance_q32 *S,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst) {
+
+    uint32_t phase = S->phase;
+    uint32_t phaseInc = S->phaseInc;
+    uint32_t blkCnt;
+    int32_t c, s;
+#if defined(PLP_MATH_LOOPUNROLL)
+    int32_t c1, s1;
+#endif
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        plp_nco_lookup_q32(phase, &c, &s);
+        plp_nco_lookup_q32(phase + phaseInc, &c1, &s1);
+        phase += 2 * phaseInc;
+        *pDst++ = c;
+        *pDst++ = s;
+        *pDst++ = c1;
+        *pDst++ = s1;
+    }
+
+    if (blockSize % 2 == 1) {
+        plp_nco_lookup_q32(phase, &c, &s);
+        phase += phaseInc;
+        *pDst++ = c;
+        *pDst++ = s;
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        plp_nco_lookup_q32(phase, &c, &s);
+        phase += phaseInc;
+        *pDst++ = c;
+        *pDst++ = s;
+    }
+
+#endif
+
+    S->phase = phase;
+}
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_vec_q32p_xpulpv2.c
+ * Description:  Parallel reciprocal square root of a 32-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup rsqrt
+*/
+
+/**
+   @addtogroup rsqrtKernels
+   @{
+*/
+
+/**
+   @brief         Parallel reciprocal square root of a 32-bit fixed point vector for XPULPV2.
+   @param[in]     task_args  pointer to plp_sqrt_vec_instance_q32 struct initialized by
+                             plp_rsqrt_vec_q32_parallel
+   @return        none
+*/
+
+void plp_rsqrt_vec_q32p_xpulpv2(void *task_args) {
+
+    plp_sqrt_vec_instance_q32 *S = (plp_sqrt_vec_instance_q32 *)task_args;
+
+    uint32_t blockSize = S->blockSize;
+    uint32_t blkSizePE = (blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = rt_core_id() * blkSizePE;
+    uint32_t len = 0;
+
+    if (start < blockSize) {
+        len = (blockSize - start < blkSizePE) ? blockSize - start : blkSizePE;
+    }
+
+    plp_rsqrt_vec_q32s_xpulpv2(S->pSrc + start, len, S->fracBits, S->pDst + start);
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of rsqrtKernels group
+ */
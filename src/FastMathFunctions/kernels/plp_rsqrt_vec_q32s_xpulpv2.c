@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_vec_q32s_xpulpv2.c
+ * Description:  Reciprocal square root of a 32-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup rsqrt
+*/
+
+/**
+   @addtogroup rsqrtKernels
+   @{
+*/
+
+/**
+   @brief      Reciprocal square root of one 32-bit fixed point sample.
+   @param[in]  x         input sample
+   @param[in]  fracBits  number of fractional bits of input and output
+   @return     1 / sqrt(x), saturated to the largest value of the format
+*/
+static inline int32_t plp_rsqrt_elem_q32(int32_t x, uint32_t fracBits) {
+    uint32_t lead, m, r;
+    int32_t k, sh;
+
+    if (x <= 0) {
+        return 0x7FFFFFFF;
+    }
+
+    // x = m * 2^(31 - k - fracBits) with m in [0.25, 1) as Q0.32 and an even exponent, k >= -1
+    lead = __builtin_clz(x);
+    k = lead - 1 - ((lead + fracBits) & 1);
+    m = (uint32_t)x << (k + 1);
+
+    // 1 / sqrt(m) in Q2.30, scaled by minus half the exponent
+    r = plp_rsqrt_mant_q32(m);
+    sh = 30 + (31 - k - (int32_t)fracBits) / 2 - (int32_t)fracBits;
+    if (sh > 32) {
+        return 0;
+    } else if (sh > 0) {
+        r = ((uint64_t)r + (1U << (sh - 1))) >> sh;
+    } else if (r > (0x7FFFFFFFU >> -sh)) {
+        return 0x7FFFFFFF;
+    } else {
+        r = r << -sh;
+    }
+
+    return (r > 0x7FFFFFFF) ? 0x7FFFFFFF : r;
+}
+
+/**
+   @brief         Reciprocal square root of a 32-bit fixed point vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   number of fractional bits of input and output
+   @param[out]    pDst       points to the output vector
+   @return        none
+*/
+
+void plp_rsqrt_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                uint32_t fracBits,
+                                int32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the seed loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_rsqrt_elem_q32(pSrc[blkCnt], fracBits);
+        pDst[blkCnt + 1] = plp_rsqrt_elem_q32(pSrc[blkCnt + 1], fracBits);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_rsqrt_elem_q32(pSrc[blkCnt], fracBits);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_rsqrt_elem_q32(pSrc[blkCnt], fracBits);
+    }
+
+#endif
+}
+
+/**
+  @} end of rsqrtKernels group
+ */
@@ -0,0 +1,121 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_vec_q8s_rv32im.c
+ * Description:  Reciprocal square root of a 8-bit fixed point vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup rsqrt
+*/
+
+/**
+   @defgroup rsqrtKernels Reciprocal Sqrt Kernels
+   @ingroup rsqrt
+*/
+
+/**
+   @addtogroup rsqrtKernels
+   @{
+*/
+
+/**
+   @brief      1 / sqrt of a normalized mantissa, 1 Newton step from the table seed.
+   @param[in]  m  mantissa in [0.25, 1) as Q1.31, i.e. in [2^29, 2^31)
+   @return     1 / sqrt(m) in Q2.30
+*/
+static inline uint32_t plp_rsqrt_mant_q8(uint32_t m) {
+    uint32_t r = (uint32_t)rsqrtTable_q16[(m >> 25) - 16] << 15;
+    uint32_t t;
+
+    // r = r * (3 - m * r^2) / 2 with r^2 and m * r^2 in Q3.29
+    t = ((uint64_t)r * r) >> 31;
+    t = ((uint64_t)m * t) >> 31;
+    r = ((uint64_t)r * ((3U << 29) - t)) >> 30;
+
+    return r;
+}
+
+/**
+   @brief      Reciprocal square root of one 8-bit fixed point sample.
+   @param[in]  x         input sample
+   @param[in]  fracBits  number of fractional bits of input and output
+   @return     1 / sqrt(x), saturated to the largest value of the format
+*/
+static inline int8_t plp_rsqrt_elem_q8(int32_t x, uint32_t fracBits) {
+    uint32_t lead, m, r;
+    int32_t k, sh;
+
+    if (x <= 0) {
+        return 0x7F;
+    }
+
+    // x = m * 2^(31 - k - fracBits) with m in [0.25, 1) and an even exponent
+    lead = __builtin_clz(x);
+    k = lead - 1 - ((lead + fracBits) & 1);
+    m = (k >= 0) ? (uint32_t)x << k : (uint32_t)x >> 1;
+
+    // 1 / sqrt(m) in Q2.30, scaled by minus half the exponent
+    r = plp_rsqrt_mant_q8(m);
+    sh = 30 + (31 - k - (int32_t)fracBits) / 2 - (int32_t)fracBits;
+    if (sh > 32) {
+        return 0;
+    } else if (sh > 0) {
+        r = ((uint64_t)r + (1U << (sh - 1))) >> sh;
+    } else if (r > (0x7FU >> -sh)) {
+        return 0x7F;
+    } else {
+        r = r << -sh;
+    }
+
+    return (r > 0x7F) ? 0x7F : r;
+}
+
+/**
+   @brief         Reciprocal square root of a 8-bit fixed point vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   number of fractional bits of input and output
+   @param[out]    pDst       points to the output vector
+   @return        none
+*/
+
+void plp_rsqrt_vec_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int8_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_rsqrt_elem_q8(pSrc[blkCnt], fracBits);
+    }
+}
+
+/**
+  @} end of rsqrtKernels group
+ */
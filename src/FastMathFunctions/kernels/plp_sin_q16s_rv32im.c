@@ -59,11 +59,11 @@ int16_t plp_sin_q16s_rv32im(int16_t x) {
     index = (uint32_t)x >> FAST_MATH_Q16_SHIFT;
 
     /* Calculation of fractional value */
-    fract = (x - (index << FAST_MATH_Q16_SHIFT)) << 9;
+    fract = (x - (index << FAST_MATH_Q16_SHIFT)) << PLP_FAST_MATH_TABLE_BITS;
 
     /* Read two nearest values of input value from the sin table */
-    a = sinTable_q16[index];
-    b = sinTable_q16[index + 1];
+    a = plp_sin_table_q16(index);
+    b = plp_sin_table_q16(index + 1);
 
     /* Linear interpolation process */
     sinVal = (int32_t)(0x8000 - fract) * a >> 16;
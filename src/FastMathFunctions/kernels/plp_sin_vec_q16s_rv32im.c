@@ -0,0 +1,59 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_vec_q16s_rv32im.c
+ * Description:  Calculates the sine of a q16 vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 vector sine function for RV32IM
+ *
+ * @param[in]   pSrc      points to the input vector, Q1.15 values, [-1, 1) mapped to [-2*PI, 2*PI)
+ * @param[in]   blockSize number of samples in input vector
+ * @param[out]  pDst      points to the sine output vector
+ *
+ * @note       The interpolation is computed at full output precision with a single rounding
+ *             step, results may differ by up to 3 LSB from plp_sin_q16 / plp_cos_q16.
+ *
+ * @return     none
+ */
+
+void plp_sin_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    uint32_t xp, index;
+    int32_t w1;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        xp = (uint16_t)pSrc[blkCnt] & 0x7FFFU;
+        index = xp >> FAST_MATH_Q16_SHIFT;
+        w1 = (xp & ((1U << FAST_MATH_Q16_SHIFT) - 1)) << (14 - FAST_MATH_Q16_SHIFT);
+        pDst[blkCnt] = plp_sin_interp_q16(index, w1);
+    }
+}
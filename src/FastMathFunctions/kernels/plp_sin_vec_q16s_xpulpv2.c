@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_vec_q16s_xpulpv2.c
+ * Description:  Calculates the sine of a q16 vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q16 vector sine function for XPULPV2
+ *
+ * @param[in]   pSrc      points to the input vector, Q1.15 values, [-1, 1) mapped to [-2*PI, 2*PI)
+ * @param[in]   blockSize number of samples in input vector
+ * @param[out]  pDst      points to the sine output vector
+ *
+ * @note       The interpolation is computed at full output precision with a single rounding
+ *             step, results may differ by up to 3 LSB from plp_sin_q16 / plp_cos_q16.
+ *
+ * @return     none
+ */
+
+void plp_sin_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    uint32_t xp, index;
+    int32_t w1;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    const v2s mask = { 0x7FFF, 0x7FFF };
+    const v2s fracMask = { (1 << FAST_MATH_Q16_SHIFT) - 1, (1 << FAST_MATH_Q16_SHIFT) - 1 };
+    const v2s mask0 = { 0, 2 };
+    const v2s mask1 = { 1, 3 };
+    v2s x, w0, w1v, w, ab;
+    uint32_t index0, index1;
+    int16_t s0, s1;
+
+    // the index and the interpolation weights of two samples are computed on the packed input,
+    // each sample is then interpolated with a single dot product of the two nearest table values
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        x = *((v2s *)(pSrc + blkCnt)) & mask;
+        w1v = (x & fracMask) << (14 - FAST_MATH_Q16_SHIFT);
+        w0 = (v2s){ 0x4000, 0x4000 } - w1v;
+        index0 = (uint16_t)x[0] >> FAST_MATH_Q16_SHIFT;
+        index1 = (uint16_t)x[1] >> FAST_MATH_Q16_SHIFT;
+        w = __builtin_shuffle(w0, w1v, mask0);
+        ab = plp_sin_table_pair_q16(index0);
+        s0 = __DOTP2(ab, w) >> 14;
+        w = __builtin_shuffle(w0, w1v, mask1);
+        ab = plp_sin_table_pair_q16(index1);
+        s1 = __DOTP2(ab, w) >> 14;
+        *((v2s *)(pDst + blkCnt)) = (v2s){ s0, s1 };
+    }
+
+    if (blockSize % 2 == 1) {
+        xp = (uint16_t)pSrc[blkCnt] & 0x7FFFU;
+        index = xp >> FAST_MATH_Q16_SHIFT;
+        w1 = (xp & ((1U << FAST_MATH_Q16_SHIFT) - 1)) << (14 - FAST_MATH_Q16_SHIFT);
+        pDst[blkCnt] = plp_sin_interp_q16(index, w1);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        xp = (uint16_t)pSrc[blkCnt] & 0x7FFFU;
+        index = xp >> FAST_MATH_Q16_SHIFT;
+        w1 = (xp & ((1U << FAST_MATH_Q16_SHIFT) - 1)) << (14 - FAST_MATH_Q16_SHIFT);
+        pDst[blkCnt] = plp_sin_interp_q16(index, w1);
+    }
+
+#endif
+}
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_vec_q32p_xpulpv2.c
+ * Description:  Parallel sine and cosine of a q32 vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Parallel q32 vector sine and cosine kernel for XPULPV2. Every core computes a
+ *             contiguous block of the outputs. Only the outputs whose pointer in the instance is
+ *             not NULL are computed.
+ *
+ * @param[in]  task_args  pointer to plp_sincos_vec_instance_q32 struct initialized by
+ *                        plp_sin_vec_q32_parallel, plp_cos_vec_q32_parallel or
+ *                        plp_sincos_vec_q32_parallel
+ *
+ * @return     none
+ */
+
+void plp_sincos_vec_q32p_xpulpv2(void *task_args) {
+
+    plp_sincos_vec_instance_q32 *S = (plp_sincos_vec_instance_q32 *)task_args;
+
+    uint32_t blockSize = S->blockSize;
+    uint32_t nPE = S->nPE;
+    uint32_t blkSizePE = (blockSize + nPE - 1) / nPE;
+    uint32_t start = rt_core_id() * blkSizePE;
+    uint32_t len = 0;
+
+    if (start < blockSize) {
+        len = (blockSize - start < blkSizePE) ? blockSize - start : blkSizePE;
+    }
+
+    if (S->pSin != NULL && S->pCos != NULL) {
+        plp_sincos_vec_q32s_xpulpv2(S->pSrc + start, len, S->pSin + start, S->pCos + start);
+    } else if (S->pSin != NULL) {
+        plp_sin_vec_q32s_xpulpv2(S->pSrc + start, len, S->pSin + start);
+    } else {
+        plp_cos_vec_q32s_xpulpv2(S->pSrc + start, len, S->pCos + start);
+    }
+
+    rt_team_barrier();
+}
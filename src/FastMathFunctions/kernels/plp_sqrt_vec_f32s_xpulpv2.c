@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sqrt_vec_f32s_xpulpv2.c
+ * Description:  Square root of a 32-bit float vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+/**
+   @brief      Square root of one 32-bit floating point sample.
+   @param[in]  x  input sample
+   @return     sqrt(x), 0 for non-positive inputs
+*/
+static inline float32_t plp_sqrt_elem_f32(float32_t x) {
+    float32_t x2, y;
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    if (x <= 0.0f) {
+        return 0.0f;
+    }
+
+    // bit level seed of 1 / sqrt(x), refined with two Newton steps
+    x2 = x * 0.5f;
+    conv.f = x;
+    conv.i = 0x5f3759df - (conv.i >> 1);
+    y = conv.f;
+    y = y * (1.5f - (x2 * y * y));
+    y = y * (1.5f - (x2 * y * y));
+
+    return x * y;
+}
+
+/**
+   @brief         Square root of a 32-bit float vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pDst       points to the output vector
+   @return        none
+*/
+
+void plp_sqrt_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the seed loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_sqrt_elem_f32(pSrc[blkCnt]);
+        pDst[blkCnt + 1] = plp_sqrt_elem_f32(pSrc[blkCnt + 1]);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_sqrt_elem_f32(pSrc[blkCnt]);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_sqrt_elem_f32(pSrc[blkCnt]);
+    }
+
+#endif
+}
+
+/**
+  @} end of sqrtKernels group
+ */
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_vec_f32s_xpulpv2.c
+ * Description:  f32 vector hyperbolic tangent function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      f32 hyperbolic tangent of one sample, cubic Hermite interpolation of
+ *             tanhTable_f32 with the slopes 1 - tanh^2 at both nodes
+ *
+ * @param[in]  x     input value
+ *
+ * @return     tanh(x)
+ */
+static inline float32_t plp_tanh_elem_f32(float32_t x) {
+    float32_t a = (x < 0.0f) ? -x : x;
+    float32_t s, f0, f1, hd0, hd1, v;
+    int32_t i;
+
+    if (a >= 8.0f) {
+        v = 1.0f;
+    } else {
+        a *= (float32_t)(1 << FAST_MATH_TANH_TABLE_BITS);
+        i = (int32_t)a;
+        s = a - (float32_t)i;
+
+        f0 = tanhTable_f32[i];
+        f1 = tanhTable_f32[i + 1];
+        hd0 = (1.0f - f0 * f0) * (1.0f / (1 << FAST_MATH_TANH_TABLE_BITS));
+        hd1 = (1.0f - f1 * f1) * (1.0f / (1 << FAST_MATH_TANH_TABLE_BITS));
+        v = 3.0f * (f1 - f0) - 2.0f * hd0 - hd1 + s * (2.0f * (f0 - f1) + hd0 + hd1);
+        v = f0 + s * (hd0 + s * v);
+    }
+    return (x < 0.0f) ? -v : v;
+}
+
+/**
+ * @brief      f32 vector hyperbolic tangent function for XPULPV2
+ *
+ * @param[in]   pSrc       points to the input vector
+ * @param[in]   blockSize  number of samples in input vector
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_tanh_elem_f32(pSrc[blkCnt]);
+        pDst[blkCnt + 1] = plp_tanh_elem_f32(pSrc[blkCnt + 1]);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_tanh_elem_f32(pSrc[blkCnt]);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_tanh_elem_f32(pSrc[blkCnt]);
+    }
+
+#endif
+}
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_vec_q32s_xpulpv2.c
+ * Description:  q32 vector hyperbolic tangent function for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+ * @brief      q32 hyperbolic tangent of one sample, cubic Hermite interpolation of tanhTable_q32
+ *             with the slopes 1 - tanh^2 at both nodes
+ *
+ * @param[in]  x         input value
+ * @param[in]  fracBits  number of fractional bits of the input
+ *
+ * @return     tanh(x) in Q1.31
+ */
+static inline int32_t plp_tanh_elem_q32(int32_t x, uint32_t fracBits) {
+    uint32_t a = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t i, s;
+    int32_t f0, f1, hd0, hd1, c2, c3;
+    int64_t v;
+
+    // |x| in Q5.27, tanh is 1 within the output precision from 8 on
+    if (fracBits <= 27U) {
+        if (a >= (8U << fracBits)) {
+            return (x < 0) ? -0x7FFFFFFF : 0x7FFFFFFF;
+        }
+        a <<= 27U - fracBits;
+    } else {
+        a >>= fracBits - 27U;
+    }
+
+    // table index and position s in [0, 1) within the table interval in Q1.31
+    i = a >> (27U - FAST_MATH_TANH_TABLE_BITS);
+    s = (a << (FAST_MATH_TANH_TABLE_BITS + 4U)) & 0x7FFFFFFFU;
+
+    f0 = tanhTable_q32[i];
+    f1 = tanhTable_q32[i + 1];
+    hd0 = (0x7FFFFFFF - (int32_t)(((int64_t)f0 * f0) >> 31)) >> FAST_MATH_TANH_TABLE_BITS;
+    hd1 = (0x7FFFFFFF - (int32_t)(((int64_t)f1 * f1) >> 31)) >> FAST_MATH_TANH_TABLE_BITS;
+    c2 = 3 * (f1 - f0) - 2 * hd0 - hd1;
+    c3 = 2 * (f0 - f1) + hd0 + hd1;
+    v = c2 + (((int64_t)s * c3) >> 31);
+    v = hd0 + (((int64_t)s * v) >> 31);
+    v = f0 + (((int64_t)s * v) >> 31);
+
+    if (v > 0x7FFFFFFF) {
+        v = 0x7FFFFFFF;
+    }
+    return (x < 0) ? -(int32_t)v : (int32_t)v;
+}
+
+/**
+ * @brief      q32 vector hyperbolic tangent function for XPULPV2
+ *
+ * @param[in]   pSrc       points to the input vector
+ * @param[in]   blockSize  number of samples in input vector
+ * @param[in]   fracBits   number of fractional bits of the input
+ * @param[out]  pDst       points to the output vector
+ *
+ * @return     none
+ */
+
+void plp_tanh_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t fracBits,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // two independent samples per iteration hide the latency of the table loads and multiplies
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        pDst[blkCnt] = plp_tanh_elem_q32(pSrc[blkCnt], fracBits);
+        pDst[blkCnt + 1] = plp_tanh_elem_q32(pSrc[blkCnt + 1], fracBits);
+    }
+
+    if (blockSize % 2 == 1) {
+        pDst[blkCnt] = plp_tanh_elem_q32(pSrc[blkCnt], fracBits);
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pDst[blkCnt] = plp_tanh_elem_q32(pSrc[blkCnt], fracBits);
+    }
+
+#endif
+}
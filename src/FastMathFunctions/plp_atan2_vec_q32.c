@@ -0,0 +1,54 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_q32.c
+ * Description:  q32 vector four quadrant arctangent glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Glue code for q32 vector four quadrant arctangent function
+ *
+ * @param[in]   pSrcY      points to the ordinates (imaginary parts)
+ * @param[in]   pSrcX      points to the abscissas (real parts)
+ * @param[in]   blockSize  number of samples in input vectors
+ * @param[out]  pDst       points to the output vector
+ *
+ * @note       Maximum absolute error 2e-7 turns, i.e. about 450 LSB.
+ *
+ * @return     none
+ */
+
+void plp_atan2_vec_q32(const int32_t *__restrict__ pSrcY,
+                       const int32_t *__restrict__ pSrcX,
+                       uint32_t blockSize,
+                       int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_atan2_vec_q32s_rv32im(pSrcY, pSrcX, blockSize, pDst);
+    } else {
+        plp_atan2_vec_q32s_xpulpv2(pSrcY, pSrcX, blockSize, pDst);
+    }
+}
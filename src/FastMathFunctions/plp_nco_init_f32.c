@@ -0,0 +1,46 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_init_f32.c
+ * Description:  Initialization of a f32 numerically controlled oscillator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Initialization function for the f32 numerically controlled oscillator
+ *
+ * @param[out]    S         points to an instance of the NCO structure
+ * @param[in]     phaseInc  phase increment per sample, f / fs * 2^32
+ * @param[in]     phase     initial phase, a full turn is 2^32
+ *
+ * @return     none
+ */
+
+void plp_nco_init_f32(plp_nco_instance_f32 *S,
+                      uint32_t phaseInc,
+                      uint32_t phase) {
+    S->phaseInc = phaseInc;
+    S->phase = phase;
+}
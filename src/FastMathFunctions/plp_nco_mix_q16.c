@@ -0,0 +1,56 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_mix_q16.c
+ * Description:  q16 numerically controlled oscillator complex mixing glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Glue code for q16 numerically controlled oscillator complex mixing
+ *
+ * @param[in,out] S         points to an instance of the NCO structure
+ * @param[in]     pSrc      points to the Q1.15 complex input vector
+ * @param[in]     blockSize number of complex samples
+ * @param[out]    pDst      points to the Q1.15 complex output vector
+ *
+ * @note       Every input sample is multiplied by exp(j * phase), the oscillator is never stored.
+ *             Use a negative (two's complement) phase increment to shift down.
+ *             The outputs are saturated, since the interpolated oscillator can exceed 1 slightly.
+ *
+ * @return     none
+ */
+
+void plp_nco_mix_q16(plp_nco_instance_q16 *S,
+                     const int16_t *__restrict__ pSrc,
+                     uint32_t blockSize,
+                     int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_nco_mix_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_nco_mix_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
@@ -0,0 +1,52 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_vec_q16.c
+ * Description:  Calculates sine and cosine of a q16 vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Glue code for q16 vector sine and cosine function
+ *
+ * @param[in]   pSrc      points to the input vector, Q1.15 values, [-1, 1) mapped to [-2*PI, 2*PI)
+ * @param[in]   blockSize number of samples in input vector
+ * @param[out]  pSin      points to the sine output vector
+ * @param[out]  pCos      points to the cosine output vector
+ *
+ * @return     none
+ */
+
+void plp_sincos_vec_q16(const int16_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int16_t *__restrict__ pSin,
+                        int16_t *__restrict__ pCos) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_sincos_vec_q16s_rv32im(pSrc, blockSize, pSin, pCos);
+    } else {
+        plp_sincos_vec_q16s_xpulpv2(pSrc, blockSize, pSin, pCos);
+    }
+}
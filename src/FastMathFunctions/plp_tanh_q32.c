@@ -0,0 +1,54 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_q32.c
+ * Description:  q32 hyperbolic tangent glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @brief      Glue code for q32 hyperbolic tangent function
+ *
+ * @param[in]   x         input value
+ * @param[in]   fracBits  number of fractional bits of the input
+ *
+ * @note       Maximum absolute error 2.5e-7, i.e. about 500 LSB.
+ *
+ * @return     tanh(x) in Q1.31
+ */
+
+int32_t plp_tanh_q32(int32_t x,
+                     uint32_t fracBits) {
+
+    int32_t res;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_tanh_vec_q32s_rv32im(&x, 1, fracBits, &res);
+    } else {
+        plp_tanh_vec_q32s_xpulpv2(&x, 1, fracBits, &res);
+    }
+
+    return res;
+}
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_f32s_xpulpv2.c
+ * Description:  32-bit floating point 2D convolution kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief 2D convolution of 32-bit float images kernel for XPULPV2 extension.
+   @param[in]  S         points to the plp_conv2d_instance_f32 describing the convolution
+   @param[in]  rowStart  first output row to compute
+   @param[in]  rowEnd    output row after the last one to compute
+   @return     none
+*/
+
+void plp_conv2d_f32s_xpulpv2(const plp_conv2d_instance_f32 *S, uint32_t rowStart, uint32_t rowEnd) {
+
+    const uint32_t kerRows = S->kerRows;
+    const uint32_t kerCols = S->kerCols;
+    const int32_t srcRows = S->srcRows;
+    const int32_t srcCols = S->srcCols;
+    const int32_t padTop = S->padTop;
+    const int32_t padLeft = S->padLeft;
+    uint32_t i, j, r, c;
+
+    for (i = rowStart; i < rowEnd; i++) {
+
+        // kernel rows that overlap the input image
+        uint32_t rFirst = ((int32_t)i < padTop) ? padTop - i : 0;
+        uint32_t rLast =
+            ((int32_t)(i + kerRows) > srcRows + padTop) ? srcRows + padTop - i : kerRows;
+
+        float32_t *pOut = S->pDst + i * S->dstStride;
+
+        for (j = 0; j < S->dstCols; j++) {
+
+            // kernel columns that overlap the input image
+            uint32_t cFirst = ((int32_t)j < padLeft) ? padLeft - j : 0;
+            uint32_t cLast =
+                ((int32_t)(j + kerCols) > srcCols + padLeft) ? srcCols + padLeft - j : kerCols;
+
+            float32_t sum = 0.0f;
+            for (r = rFirst; r < rLast; r++) {
+                const float32_t *pIn =
+                    S->pSrc + (i + r - padTop) * S->srcStride + ((int32_t)j - padLeft);
+                const float32_t *pK = S->pKernel + (kerRows - r) * kerCols - 1;
+                c = cFirst;
+#if defined(PLP_MATH_LOOPUNROLL)
+                for (; c + 1 < cLast; c += 2) {
+                    sum += pIn[c] * pK[-(int32_t)c];
+                    sum += pIn[c + 1] * pK[-(int32_t)c - 1];
+                }
+#endif // PLP_MATH_LOOPUNROLL
+                for (; c < cLast; c++) {
+                    sum += pIn[c] * pK[-(int32_t)c];
+                }
+            }
+            pOut[j] = sum;
+        }
+    }
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
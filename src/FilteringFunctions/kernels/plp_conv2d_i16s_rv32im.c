@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i16s_rv32im.c
+ * Description:  16-bit integer 2D convolution kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief 2D convolution of 16-bit integer images kernel for RV32IM extension.
+   @param[in]  S  points to the plp_conv2d_instance_i16 describing the convolution, pKernel in
+                  natural order
+   @return     none
+*/
+
+void plp_conv2d_i16s_rv32im(const plp_conv2d_instance_i16 *S) {
+
+    const int16_t *pSrc = S->pSrc;
+    const int16_t *pKernel = S->pKernel;
+    const uint32_t kerRows = S->kerRows;
+    const uint32_t kerCols = S->kerCols;
+    const int32_t padTop = S->padTop;
+    const int32_t padLeft = S->padLeft;
+    const int32_t srcRows = S->srcRows;
+    const int32_t srcCols = S->srcCols;
+    int32_t i, j, r, c, ri, ci;
+
+    for (i = 0; i < S->dstRows; i++) {
+        int32_t *pOut = S->pDst + i * S->dstStride;
+        for (j = 0; j < S->dstCols; j++) {
+            int32_t sum = 0;
+            for (r = 0; r < kerRows; r++) {
+                ri = i + r - padTop;
+                if (ri < 0 || ri >= srcRows) {
+                    continue;
+                }
+                for (c = 0; c < kerCols; c++) {
+                    ci = j + c - padLeft;
+                    if (ci >= 0 && ci < srcCols) {
+                        sum += pSrc[ri * S->srcStride + ci] *
+                               pKernel[(kerRows - 1 - r) * kerCols + (kerCols - 1 - c)];
+                    }
+                }
+            }
+            pOut[j] = sum;
+        }
+    }
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8p_xpulpv2.c
+ * Description:  8-bit integer parallel 2D convolution kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief Parallel 2D convolution of 8-bit integer images kernel for XPULPV2 extension. Every core
+   computes a contiguous band of output rows with its own copy ring in pScratch.
+   @param[in]  task_args  pointer to plp_conv2d_instance_i8 struct initialized by
+                          plp_conv2d_i8_parallel
+   @return     none
+*/
+
+void plp_conv2d_i8p_xpulpv2(void *task_args) {
+
+    plp_conv2d_instance_i8 *S = (plp_conv2d_instance_i8 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t blkSize = (S->dstRows + S->nPE - 1) / S->nPE;
+    uint32_t rowStart = core_id * blkSize;
+    uint32_t rowEnd = (rowStart + blkSize < S->dstRows) ? rowStart + blkSize : S->dstRows;
+
+    if (rowStart < rowEnd) {
+        plp_conv2d_i8s_xpulpv2(S, rowStart, rowEnd, S->pScratch + core_id * S->scratchSizePE);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
@@ -0,0 +1,148 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8s_xpulpv2.c
+ * Description:  8-bit integer 2D convolution kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief 2D convolution of 8-bit integer images kernel for XPULPV2 extension.
+   @param[in]  S         points to the plp_conv2d_instance_i8 describing the convolution, pKerFlip
+                         must hold the flipped kernel with rows zero-padded to a multiple of 4
+   @param[in]  rowStart  first output row to compute
+   @param[in]  rowEnd    output row after the last one to compute
+   @param[in]  pRep      points to a scratch buffer of kerRows*4*repLen samples in L1, repLen as
+                         computed below
+   @return     none
+
+   @par Exploiting SIMD instructions
+        Every input row entering the kernel window is copied 4 times, each copy shifted by one
+   more sample and zero-padded on both sides for the same mode. The window of output column j then
+   starts at an aligned address of copy j % 4, so all loads are aligned v4s loads and 4
+   neighbouring outputs share the kernel loads. The copies of kerRows rows are kept in a ring,
+   hence every input row is copied once per call.
+*/
+
+void plp_conv2d_i8s_xpulpv2(const plp_conv2d_instance_i8 *S,
+                            uint32_t rowStart,
+                            uint32_t rowEnd,
+                            int8_t *pRep) {
+
+    const int8_t *pKer = S->pKerFlip;
+    const uint32_t kerRows = S->kerRows;
+    const uint32_t kerColsAl = (S->kerCols + 3) & ~3U;
+    const uint32_t dstCols = S->dstCols;
+    const int32_t srcRows = S->srcRows;
+    const int32_t srcCols = S->srcCols;
+    const int32_t padTop = S->padTop;
+    const int32_t padLeft = S->padLeft;
+
+    // every copy covers the padded input seen by all output columns
+    const uint32_t repLen = (dstCols - 1 + kerColsAl + 3) & ~3U;
+    const uint32_t rowMem = repLen * 4;
+
+    uint32_t i, j, r, c, s;
+    int32_t ri, ci;
+
+    for (i = rowStart; i < rowEnd; i++) {
+
+        // copy the input rows entering the window into the ring
+        for (r = (i == rowStart) ? 0 : kerRows - 1; r < kerRows; r++) {
+            ri = (int32_t)(i + r) - padTop;
+            if (ri < 0 || ri >= srcRows) {
+                continue;
+            }
+            const int8_t *pIn = S->pSrc + ri * S->srcStride;
+            int8_t *pCpy = pRep + (ri % kerRows) * rowMem;
+            for (s = 0; s < 4; s++) {
+                for (c = 0; c < repLen; c++) {
+                    ci = (int32_t)(c + s) - padLeft;
+                    *pCpy++ = (ci >= 0 && ci < srcCols) ? pIn[ci] : 0;
+                }
+            }
+        }
+
+        // kernel rows that overlap the input image
+        uint32_t rFirst = ((int32_t)i < padTop) ? padTop - i : 0;
+        uint32_t rLast =
+            ((int32_t)(i + kerRows) > srcRows + padTop) ? srcRows + padTop - i : kerRows;
+
+        int32_t *pOut = S->pDst + i * S->dstStride;
+        const int8_t *px;
+        v4s k;
+        j = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+        int32_t acc0, acc1, acc2, acc3;
+
+        for (; j + 3 < dstCols; j += 4) {
+            acc0 = 0;
+            acc1 = 0;
+            acc2 = 0;
+            acc3 = 0;
+            for (r = rFirst; r < rLast; r++) {
+                px = pRep + ((i + r - padTop) % kerRows) * rowMem + j;
+                for (c = 0; c < kerColsAl; c += 4) {
+                    k = *((v4s *)(pKer + r * kerColsAl + c));
+                    acc0 = __SUMDOTP4(*((v4s *)(px + c)), k, acc0);
+                    acc1 = __SUMDOTP4(*((v4s *)(px + 1 * repLen + c)), k, acc1);
+                    acc2 = __SUMDOTP4(*((v4s *)(px + 2 * repLen + c)), k, acc2);
+                    acc3 = __SUMDOTP4(*((v4s *)(px + 3 * repLen + c)), k, acc3);
+                }
+            }
+            pOut[j + 0] = acc0;
+            pOut[j + 1] = acc1;
+            pOut[j + 2] = acc2;
+            pOut[j + 3] = acc3;
+        }
+#endif // PLP_MATH_LOOPUNROLL
+
+        for (; j < dstCols; j++) {
+            int32_t sum = 0;
+            for (r = rFirst; r < rLast; r++) {
+                px = pRep + ((i + r - padTop) % kerRows) * rowMem + (j % 4) * repLen + (j & ~3U);
+                for (c = 0; c < kerColsAl; c += 4) {
+                    k = *((v4s *)(pKer + r * kerColsAl + c));
+                    sum = __SUMDOTP4(*((v4s *)(px + c)), k, sum);
+                }
+            }
+            pOut[j] = sum;
+        }
+    }
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_sep_i8s_xpulpv2.c
+ * Description:  8-bit integer separable 2D convolution kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief Vertical pass of the separable 2D convolution of 8-bit integer images kernel
+   for XPULPV2 extension.
+   @param[in]  pBuffer    points to the output of the horizontal pass, srcRows x dstCols
+   @param[in]  srcRows    number of rows of the input image
+   @param[in]  pKerCol    points to the vertical kernel of length kerRows
+   @param[in]  kerRows    number of taps of the vertical kernel
+   @param[in]  padTop     number of zero rows above the image
+   @param[in]  dstRows    number of output rows
+   @param[in]  dstCols    number of output columns
+   @param[out] pDst       points to the output image
+   @param[in]  dstStride  number of elements between the starts of two output rows
+   @return     none
+*/
+
+void plp_conv2d_sep_i8s_xpulpv2(const int32_t *pBuffer,
+                                uint32_t srcRows,
+                                const int8_t *pKerCol,
+                                uint32_t kerRows,
+                                uint32_t padTop,
+                                uint32_t dstRows,
+                                uint32_t dstCols,
+                                int32_t *pDst,
+                                uint32_t dstStride) {
+
+    uint32_t i, j, r;
+
+    for (i = 0; i < dstRows; i++) {
+        // kernel taps that overlap the input image
+        uint32_t rFirst = (i < padTop) ? padTop - i : 0;
+        uint32_t rLast = (i + kerRows > srcRows + padTop) ? srcRows + padTop - i : kerRows;
+        int32_t *pOut = pDst + i * dstStride;
+        j = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+        for (; j + 1 < dstCols; j += 2) {
+            int32_t sum0 = 0, sum1 = 0;
+            for (r = rFirst; r < rLast; r++) {
+                const int32_t *pIn = pBuffer + (i + r - padTop) * dstCols + j;
+                int32_t k = pKerCol[kerRows - 1 - r];
+                sum0 += pIn[0] * k;
+                sum1 += pIn[1] * k;
+            }
+            pOut[j] = sum0;
+            pOut[j + 1] = sum1;
+        }
+#endif // PLP_MATH_LOOPUNROLL
+
+        for (; j < dstCols; j++) {
+            int32_t sum = 0;
+            for (r = rFirst; r < rLast; r++) {
+                sum += pBuffer[(i + r - padTop) * dstCols + j] * pKerCol[kerRows - 1 - r];
+            }
+            pOut[j] = sum;
+        }
+    }
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
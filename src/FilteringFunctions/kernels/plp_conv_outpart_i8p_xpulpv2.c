@@ -0,0 +1,144 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_outpart_i8p_xpulpv2.c
+ * Description:  8-bit output-partitioned parallel integer convolution kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define shufflemask1                                                                               \
+    (v4s) { 3, 2, 1, 0 }
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Computes a single output sample of the partially overlapping (edge) region.
+   @param[in]  px     points to the first sample of pSrcA that overlaps
+   @param[in]  py     points to the last sample of pSrcB that overlaps (walked backwards)
+   @param[in]  count  number of overlapping samples
+   @return     sum of px[i] * py[-i] for i = 0 .. count-1
+*/
+static inline int32_t plp_conv_edge_i8(const int8_t *px, const int8_t *py, uint32_t count) {
+    int32_t sum = 0;
+    v4s _x1, _y1;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    uint32_t k = count >> 2U;
+    while (k > 0U) {
+        _x1 = *((v4s *)(px));     // { x[0], x[1], x[2], x[3] }
+        _y1 = *((v4s *)(py - 3)); // { y[-3], y[-2], y[-1], y[0] }
+        _y1 = __builtin_shuffle(_y1, _y1, shufflemask1);
+        sum = __SUMDOTP4(_x1, _y1, sum);
+        px += 4;
+        py -= 4;
+        k--;
+    }
+
+    k = count % 0x4U;
+    while (k > 0U) {
+        sum = __MAC(sum, *px++, *py--);
+        k--;
+    }
+#else
+    while (count > 0U) {
+        sum = __MAC(sum, *px++, *py--);
+        count--;
+    }
+#endif
+
+    return sum;
+}
+
+/**
+   @brief Output-partitioned parallel convolution of 8-bit integer vectors kernel for XPULPV2
+   extension. Every core computes a disjoint, contiguous range of output samples directly into
+   pRes, hence no intermediate buffer and no overlap-add step are needed.
+   @param[in]  task_args     pointer to plp_conv_instance_i8 struct initialized by
+   plp_conv_i8_parallel
+   @return        none
+*/
+
+// Pre-condition: srcALen >= srcBLen, established by calling function plp_conv_i8_parallel
+// Pre-condition: pRes has enough allocated memory, i.e. srcALen + srcBLen-1u
+
+void plp_conv_outpart_i8p_xpulpv2(void *task_args) {
+
+    plp_conv_instance_i8 *S = (plp_conv_instance_i8 *)task_args;
+
+    const int8_t *pSrcA = S->pSrcA;
+    const int8_t *pSrcB = S->pSrcB;
+    const uint32_t srcALen = S->srcALen;
+    const uint32_t srcBLen = S->srcBLen;
+
+    uint32_t resLen = srcALen + srcBLen - 1;
+    uint32_t blkSize = (resLen + S->nPE - 1) / S->nPE;
+    uint32_t n = rt_core_id() * blkSize;
+    uint32_t end = n + blkSize;
+
+    // outputs [srcBLen-1, srcALen) see all samples of pSrcB (valid part), the rest is the edge
+    uint32_t validStart = srcBLen - 1;
+    uint32_t validEnd = srcALen;
+
+    int32_t *pOut = S->pRes + n;
+
+    if (end > resLen) {
+        end = resLen;
+    }
+
+    // leading edge: the overlap grows by one sample per output
+    while (n < end && n < validStart) {
+        *pOut++ = plp_conv_edge_i8(pSrcA, pSrcB + n, n + 1);
+        n++;
+    }
+
+    // valid part: all srcBLen samples overlap, reuse the unrolled valid kernel
+    if (n < end && n < validEnd) {
+        uint32_t validLen = ((end < validEnd) ? end : validEnd) - n;
+        plp_conv_valid_i8s_xpulpv2(pSrcA + (n - validStart), validLen + srcBLen - 1, pSrcB,
+                                    srcBLen, pOut);
+        pOut += validLen;
+        n += validLen;
+    }
+
+    // trailing edge: the overlap shrinks by one sample per output
+    while (n < end) {
+        *pOut++ =
+            plp_conv_edge_i8(pSrcA + (n - validStart), pSrcB + validStart, resLen - n);
+        n++;
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of BasicConvolutionKernels
+*/
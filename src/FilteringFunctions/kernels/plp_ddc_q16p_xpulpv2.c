@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ddc_q16p_xpulpv2.c
+ * Description:  16-bit fixed point parallel multi-channel digital down-converter kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup DDC
+*/
+
+/**
+   @addtogroup DDCKernels
+   @{
+*/
+
+/**
+   @brief Parallel multi-channel digital down-conversion of 16-bit fixed point complex vectors
+   kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_ddc_instance_q16_parallel struct initialized by
+                          plp_ddc_q16_parallel
+   @return     none
+*/
+
+void plp_ddc_q16p_xpulpv2(void *task_args) {
+
+    plp_ddc_instance_q16_parallel *P = task_args;
+
+    uint32_t blockSize = P->blockSize;
+    uint32_t D = P->S[0].decimFactor;
+    uint32_t dstLen = (blockSize + D - 1) / D;
+    uint32_t ch;
+
+    for (ch = rt_core_id(); ch < P->nChannels; ch += P->nPE) {
+        plp_ddc_q16s_xpulpv2(&P->S[ch], P->pSrc + 2 * ch * blockSize, blockSize,
+                             P->pDst + 2 * ch * dstLen, &P->pDstLen[ch]);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of DDCKernels group
+*/
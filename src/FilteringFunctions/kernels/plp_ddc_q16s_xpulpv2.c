@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ddc_q16s_xpulpv2.c
+ * Description:  16-bit fixed point digital down-converter kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup DDC
+*/
+
+/**
+   @addtogroup DDCKernels
+   @{
+*/
+
+/**
+   @brief Digital down-conversion of 16-bit fixed point complex vectors kernel for XPULPV2
+   extension.
+   @param[in]  S          points to an instance of the down-converter structure
+   @param[in]  pSrc       points to the Q1.15 complex input block
+   @param[in]  blockSize  number of complex input samples
+   @param[out] pDst       points to the complex output block
+   @param[out] pDstLen    number of complex output samples written to pDst
+   @return     none
+*/
+
+void plp_ddc_q16s_xpulpv2(plp_ddc_instance_q16 *S,
+                          const int16_t *pSrc,
+                          uint32_t blockSize,
+                          int16_t *pDst,
+                          uint32_t *pDstLen) {
+
+    const uint32_t numTaps = S->numTaps;
+    const uint32_t D = S->decimFactor;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pStateI = S->pState;
+    int16_t *pStateQ = S->pState + numTaps - 1 + S->blockSize;
+
+    uint32_t phase = S->nco.phase;
+    uint32_t phaseInc = S->nco.phaseInc;
+    uint32_t i = S->index; // newest input sample of the window of the next output
+    uint32_t n = 0, k;
+    int32_t accI, accQ;
+    int16_t c, s;
+    v2s x;
+
+    // mix the new block to baseband, saturated as in plp_nco_mix_q16, and append it behind the
+    // history of both delay lines
+    for (k = 0; k < blockSize; k++) {
+        plp_nco_lookup_q16(phase, &c, &s);
+        phase += phaseInc;
+        x = *((v2s *)(pSrc + 2 * k));
+        pStateI[numTaps - 1 + k] = __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ c, -s })), 15), 15);
+        pStateQ[numTaps - 1 + k] = __CLIP(__ROUNDNORM_REG(__DOTP2(x, ((v2s){ s, c })), 15), 15);
+    }
+
+    // filter only at the samples that are kept after decimation
+    while (i < blockSize) {
+        plp_dot_prod_q16s_xpulpv2(pCoeffs, pStateI + i, numTaps, S->deciPoint, &accI);
+        plp_dot_prod_q16s_xpulpv2(pCoeffs, pStateQ + i, numTaps, S->deciPoint, &accQ);
+        pDst[2 * n] = (int16_t)__CLIP(accI, 15);
+        pDst[2 * n + 1] = (int16_t)__CLIP(accQ, 15);
+        n++;
+        i += D;
+    }
+
+    S->index = i - blockSize;
+    S->nco.phase = phase;
+
+    // keep the last numTaps-1 mixed samples for the next block
+    for (k = 0; k + 1 < numTaps; k++) {
+        pStateI[k] = pStateI[blockSize + k];
+        pStateQ[k] = pStateQ[blockSize + k];
+    }
+
+    *pDstLen = n;
+}
+
+/**
+   @} end of DDCKernels group
+*/
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q32s_rv32im.c
+ * Description:  32-bit fixed point LMS filter kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LMS
+*/
+
+/**
+   @addtogroup LMSKernels
+   @{
+*/
+
+/**
+   @brief LMS filter for 32-bit fixed point vectors kernel for RV32IM extension.
+   @param[in]  S          points to an instance of the LMS structure
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  pRef       points to the block of reference (desired) samples
+   @param[out] pOut       points to the block of output samples
+   @param[out] pErr       points to the block of error samples
+   @param[in]  blockSize  number of samples to process
+   @return     none
+*/
+
+void plp_lms_q32s_rv32im(plp_lms_instance_q32 *S,
+                         const int32_t *pSrc,
+                         const int32_t *pRef,
+                         int32_t *pOut,
+                         int32_t *pErr,
+                         uint32_t blockSize) {
+
+    const uint32_t numTaps = S->numTaps;
+    const uint32_t deciPoint = S->deciPoint;
+    int32_t *pState = S->pState;
+    int32_t *pCoeffs = S->pCoeffs;
+    int32_t gain = S->gain; // update of the previous sample, not yet applied
+    uint32_t n, k;
+
+    // append the new block behind the history
+    for (n = 0; n < blockSize; n++) {
+        pState[numTaps + n] = pSrc[n];
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const int32_t *px0 = pState + n;     // window of the previous sample
+        const int32_t *px1 = pState + n + 1; // window of the current sample
+        int32_t *pw = pCoeffs;
+        int32_t acc = 0;
+
+        for (k = 0; k < numTaps; k++) {
+            *pw += __ROUNDNORM_REG(gain * (*px0++), deciPoint);
+            acc += __ROUNDNORM_REG((*pw++) * (*px1++), deciPoint);
+        }
+
+        int32_t err = pRef[n] - acc;
+        pOut[n] = acc;
+        pErr[n] = err;
+
+        gain = __ROUNDNORM_REG(S->mu * err, deciPoint);
+    }
+
+    S->gain = gain;
+
+    // keep the last numTaps input samples for the next block
+    for (k = 0; k < numTaps; k++) {
+        pState[k] = pState[blockSize + k];
+    }
+}
+
+/**
+   @} end of LMSKernels group
+*/
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16s_xpulpv2.c
+ * Description:  16-bit integer median filter kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MedianFilter
+*/
+
+/**
+   @addtogroup MedianFilterKernels
+   @{
+*/
+
+/**
+   @brief Median filter of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  S          points to an instance of the median filter structure
+   @param[in]  pSrc       points to the block of input samples
+   @param[out] pDst       points to the block of output samples
+   @param[in]  blockSize  number of samples to process
+   @return     none
+*/
+
+void plp_median_filter_i16s_xpulpv2(plp_median_filter_instance_i16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pDst,
+                                    uint32_t blockSize) {
+
+    const uint32_t winLen = S->winLen;
+    uint32_t index = S->index;
+    int16_t *pState = S->pState;
+    int16_t *pSorted = S->pSorted;
+    uint32_t n, lo, hi, mid, pos;
+
+    for (n = 0; n < blockSize; n++) {
+        int16_t x = pSrc[n];
+        int16_t old = pState[index];
+
+        pState[index] = x;
+        index = (index + 1 == winLen) ? 0 : index + 1;
+
+        // binary search for the position of the sample leaving the window
+        lo = 0;
+        hi = winLen - 1;
+        while (lo < hi) {
+            mid = (lo + hi) >> 1;
+            if (pSorted[mid] < old) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        pos = lo;
+
+        // slide the new sample from there to its sorted position
+        if (x > old) {
+            while (pos + 1 < winLen && pSorted[pos + 1] < x) {
+                pSorted[pos] = pSorted[pos + 1];
+                pos++;
+            }
+        } else {
+            while (pos > 0 && pSorted[pos - 1] > x) {
+                pSorted[pos] = pSorted[pos - 1];
+                pos--;
+            }
+        }
+        pSorted[pos] = x;
+
+        pDst[n] = pSorted[winLen >> 1];
+    }
+
+    S->index = index;
+}
+
+/**
+   @} end of MedianFilterKernels group
+*/
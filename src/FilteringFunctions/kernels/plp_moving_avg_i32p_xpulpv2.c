@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_i32p_xpulpv2.c
+ * Description:  32-bit integer multi-channel moving average filter kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MovingAvg
+*/
+
+/**
+   @addtogroup MovingAvgKernels
+   @{
+*/
+
+/**
+   @brief Parallel multi-channel moving average filter of 32-bit integer vectors kernel for
+   XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_moving_avg_instance_i32_parallel struct initialized by
+                          plp_moving_avg_i32_parallel
+   @return     none
+*/
+
+void plp_moving_avg_i32p_xpulpv2(void *task_args) {
+
+    plp_moving_avg_instance_i32_parallel *P = task_args;
+
+    uint32_t blockSize = P->blockSize;
+    uint32_t offset;
+    uint32_t ch;
+
+    for (ch = rt_core_id(); ch < P->nChannels; ch += P->nPE) {
+        offset = ch * blockSize;
+        plp_moving_avg_i32s_xpulpv2(&P->S[ch], P->pSrc + offset, P->pDst + offset, blockSize);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of MovingAvgKernels group
+*/
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_i32s_rv32im.c
+ * Description:  32-bit integer moving average filter kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup MovingAvg
+*/
+
+/**
+   @addtogroup MovingAvgKernels
+   @{
+*/
+
+/**
+   @brief Moving average filter of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]  S          points to an instance of the moving average filter structure
+   @param[in]  pSrc       points to the block of input samples
+   @param[out] pDst       points to the block of output samples
+   @param[in]  blockSize  number of samples to process
+   @return     none
+*/
+
+void plp_moving_avg_i32s_rv32im(plp_moving_avg_instance_i32 *S,
+                                const int32_t *pSrc,
+                                int32_t *pDst,
+                                uint32_t blockSize) {
+
+    const uint32_t winLen = S->winLen;
+    uint32_t index = S->index;
+    int32_t *pState = S->pState;
+    int64_t sum = S->sum;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        int32_t x = pSrc[n];
+
+        // replace the oldest sample of the window by the new one
+        sum += (int64_t)x - pState[index];
+        pState[index] = x;
+        index = (index + 1 == winLen) ? 0 : index + 1;
+
+        pDst[n] = (int32_t)(sum / (int32_t)winLen);
+    }
+
+    S->index = index;
+    S->sum = sum;
+}
+
+/**
+   @} end of MovingAvgKernels group
+*/
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_f32p_xpulpv2.c
+ * Description:  32-bit floating point parallel polyphase resampler kernel for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Resample
+*/
+
+/**
+   @addtogroup ResampleKernels
+   @{
+*/
+
+/**
+   @brief Parallel polyphase resampling of 32-bit float vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_resample_instance_f32_parallel struct initialized by
+                          plp_resample_f32_parallel
+   @return     none
+*/
+
+void plp_resample_f32p_xpulpv2(void *task_args) {
+
+    plp_resample_instance_f32_parallel *P = (plp_resample_instance_f32_parallel *)task_args;
+    const plp_resample_instance_f32 *S = P->S;
+
+    const uint32_t L = S->upFactor;
+    const uint32_t M = S->downFactor;
+    const uint32_t phaseLen = S->phaseLen;
+    const float32_t *pCoeffs = S->pCoeffs;
+    float32_t *pState = S->pState;
+    float32_t *pDst = P->pDst;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t nPE = P->nPE;
+    uint32_t k, kEnd;
+
+    // append the new block behind the history, every core copies its share
+    uint32_t cpySize = (P->blockSize + nPE - 1) / nPE;
+    k = core_id * cpySize;
+    kEnd = (k + cpySize < P->blockSize) ? k + cpySize : P->blockSize;
+    for (; k < kEnd; k++) {
+        pState[phaseLen - 1 + k] = P->pSrc[k];
+    }
+
+    rt_team_barrier();
+
+    uint32_t blkSize = (P->nOut + nPE - 1) / nPE;
+    uint32_t n = core_id * blkSize;
+    uint32_t nEnd = (n + blkSize < P->nOut) ? n + blkSize : P->nOut;
+
+    const uint32_t stepI = M / L;
+    const uint32_t stepP = M % L;
+
+    uint32_t t = S->phase + n * M; // position of the first output on the upsampled grid
+    uint32_t i = t / L;
+    uint32_t p = t % L;
+    float32_t acc;
+
+    for (; n < nEnd; n++) {
+        plp_dot_prod_f32s_xpulpv2(pCoeffs + p * phaseLen, pState + i, phaseLen, &acc);
+        pDst[n] = acc;
+
+        i += stepI;
+        p += stepP;
+        if (p >= L) {
+            p -= L;
+            i++;
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of ResampleKernels group
+*/
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_q16s_rv32im.c
+ * Description:  16-bit fixed point polyphase resampler kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Resample
+*/
+
+/**
+   @defgroup ResampleKernels Polyphase Resampling Kernels
+   Computes the output samples of the polyphase resampler for one input block.
+*/
+
+/**
+   @addtogroup ResampleKernels
+   @{
+*/
+
+/**
+   @brief Polyphase resampling of 16-bit fixed point vectors kernel for RV32IM extension.
+   @param[in]  S          points to an instance of the resampler structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  blockSize  number of input samples
+   @param[out] pDst       points to the output block
+   @param[out] pDstLen    number of output samples written to pDst
+   @return     none
+*/
+
+void plp_resample_q16s_rv32im(plp_resample_instance_q16 *S,
+                              const int16_t *pSrc,
+                              uint32_t blockSize,
+                              int16_t *pDst,
+                              uint32_t *pDstLen) {
+
+    const uint32_t L = S->upFactor;
+    const uint32_t phaseLen = S->phaseLen;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+
+    // advance of one output on the input grid, split in whole samples and phase
+    const uint32_t stepI = S->downFactor / L;
+    const uint32_t stepP = S->downFactor % L;
+
+    uint32_t i = S->phase / L; // newest input sample of the current window
+    uint32_t p = S->phase % L; // sub-filter of the current output
+    uint32_t n = 0, k;
+    int32_t acc;
+
+    // append the new block behind the history
+    for (k = 0; k < blockSize; k++) {
+        pState[phaseLen - 1 + k] = pSrc[k];
+    }
+
+    while (i < blockSize) {
+        plp_dot_prod_q16s_rv32im(pCoeffs + p * phaseLen, pState + i, phaseLen, S->deciPoint, &acc);
+        pDst[n] = (int16_t)__CLIP(acc, 15);
+        n++;
+
+        i += stepI;
+        p += stepP;
+        if (p >= L) {
+            p -= L;
+            i++;
+        }
+    }
+
+    S->phase = (i - blockSize) * L + p;
+
+    // keep the last phaseLen-1 input samples for the next block
+    for (k = 0; k + 1 < phaseLen; k++) {
+        pState[k] = pState[blockSize + k];
+    }
+
+    *pDstLen = n;
+}
+
+/**
+   @} end of ResampleKernels group
+*/
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_f32.c
+ * Description:  32-bit floating point 2D convolution glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Conv2d
+   @{
+*/
+
+/**
+   @brief Glue code for 2D convolution of 32-bit float images.
+   @param[in]  pSrc       points to the input image
+   @param[in]  srcRows    number of rows of the input image
+   @param[in]  srcCols    number of columns of the input image
+   @param[in]  srcStride  number of elements between the starts of two input rows
+   @param[in]  pKernel    points to the kernel, kerRows x kerCols, row major
+   @param[in]  kerRows    number of rows of the kernel
+   @param[in]  kerCols    number of columns of the kernel
+   @param[in]  padding    PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[out] pDst       points to the output image
+   @param[in]  dstStride  number of elements between the starts of two output rows
+   @return     none
+*/
+
+void plp_conv2d_f32(const float32_t *pSrc,
+                    uint32_t srcRows,
+                    uint32_t srcCols,
+                    uint32_t srcStride,
+                    const float32_t *pKernel,
+                    uint32_t kerRows,
+                    uint32_t kerCols,
+                    uint32_t padding,
+                    float32_t *pDst,
+                    uint32_t dstStride) {
+
+    uint32_t padTop = 0, padLeft = 0;
+    uint32_t dstRows = srcRows - kerRows + 1;
+    uint32_t dstCols = srcCols - kerCols + 1;
+
+    if (padding == PLP_CONV2D_SAME) {
+        padTop = kerRows >> 1;
+        padLeft = kerCols >> 1;
+        dstRows = srcRows;
+        dstCols = srcCols;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_conv2d_instance_f32 S = { .pSrc = pSrc,
+                                      .srcRows = srcRows,
+                                      .srcCols = srcCols,
+                                      .srcStride = srcStride,
+                                      .pKernel = pKernel,
+                                      .kerRows = kerRows,
+                                      .kerCols = kerCols,
+                                      .padTop = padTop,
+                                      .padLeft = padLeft,
+                                      .dstRows = dstRows,
+                                      .dstCols = dstCols,
+                                      .dstStride = dstStride,
+                                      .nPE = 1,
+                                      .pDst = pDst };
+
+        plp_conv2d_f32s_xpulpv2(&S, 0, dstRows);
+    }
+}
+
+/**
+   @} end of Conv2d group
+*/
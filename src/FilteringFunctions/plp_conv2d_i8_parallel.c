@@ -0,0 +1,135 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8_parallel.c
+ * Description:  8-bit integer parallel 2D convolution glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Conv2d
+   @{
+*/
+
+/**
+   @brief Glue code for parallel 2D convolution of 8-bit integer images.
+   @param[in]  pSrc       points to the input image
+   @param[in]  srcRows    number of rows of the input image
+   @param[in]  srcCols    number of columns of the input image
+   @param[in]  srcStride  number of elements between the starts of two input rows
+   @param[in]  pKernel    points to the kernel, kerRows x kerCols, row major
+   @param[in]  kerRows    number of rows of the kernel
+   @param[in]  kerCols    number of columns of the kernel
+   @param[in]  padding    PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pDst       points to the output image
+   @param[in]  dstStride  number of elements between the starts of two output rows
+   @return     none
+
+   @par Parallelization
+        The output rows are split into contiguous bands, one per core, such that every core slides
+   its own copy ring over the input rows of its band.
+*/
+
+void plp_conv2d_i8_parallel(const int8_t *pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            uint32_t srcStride,
+                            const int8_t *pKernel,
+                            uint32_t kerRows,
+                            uint32_t kerCols,
+                            uint32_t padding,
+                            uint8_t nPE,
+                            int32_t *pDst,
+                            uint32_t dstStride) {
+
+    uint32_t padTop = 0, padLeft = 0;
+    uint32_t dstRows = srcRows - kerRows + 1;
+    uint32_t dstCols = srcCols - kerCols + 1;
+
+    if (padding == PLP_CONV2D_SAME) {
+        padTop = kerRows >> 1;
+        padLeft = kerCols >> 1;
+        dstRows = srcRows;
+        dstCols = srcCols;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t kerColsAl = (kerCols + 3) & ~3U;
+        uint32_t kerSize = kerRows * kerColsAl;
+        uint32_t repLen = (dstCols - 1 + kerColsAl + 3) & ~3U;
+        uint32_t scratchSizePE = kerRows * 4 * repLen;
+        uint32_t scratchSize = kerSize + nPE * scratchSizePE;
+        uint32_t r, c;
+
+        int8_t *pScratch = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * scratchSize);
+        if (pScratch == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+        int8_t *pKerFlip = pScratch;
+
+        // flip the kernel and zero-pad its rows to a multiple of 4 samples
+        for (r = 0; r < kerRows; r++) {
+            for (c = 0; c < kerColsAl; c++) {
+                pKerFlip[r * kerColsAl + c] =
+                    (c < kerCols) ? pKernel[(kerRows - 1 - r) * kerCols + (kerCols - 1 - c)] : 0;
+            }
+        }
+
+        plp_conv2d_instance_i8 S = { .pSrc = pSrc,
+                                     .srcRows = srcRows,
+                                     .srcCols = srcCols,
+                                     .srcStride = srcStride,
+                                     .pKernel = pKernel,
+                                     .kerRows = kerRows,
+                                     .kerCols = kerCols,
+                                     .padTop = padTop,
+                                     .padLeft = padLeft,
+                                     .dstRows = dstRows,
+                                     .dstCols = dstCols,
+                                     .dstStride = dstStride,
+                                     .pKerFlip = pKerFlip,
+                                     .nPE = nPE,
+                                     .pScratch = pScratch + kerSize,
+                                     .scratchSizePE = scratchSizePE,
+                                     .pDst = pDst };
+
+        rt_team_fork(nPE, plp_conv2d_i8p_xpulpv2, (void *)&S);
+
+        rt_free(RT_ALLOC_CL_DATA, pScratch, sizeof(int8_t) * scratchSize);
+    }
+}
+
+/**
+   @} end of Conv2d group
+*/
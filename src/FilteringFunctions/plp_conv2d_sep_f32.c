@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_sep_f32.c
+ * Description:  32-bit floating point separable 2D convolution glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Conv2d
+   @{
+*/
+
+/**
+   @brief Glue code for separable 2D convolution of 32-bit float images.
+   @param[in]  pSrc       points to the input image
+   @param[in]  srcRows    number of rows of the input image
+   @param[in]  srcCols    number of columns of the input image
+   @param[in]  srcStride  number of elements between the starts of two input rows
+   @param[in]  pKerRow    points to the horizontal kernel of length kerCols
+   @param[in]  kerCols    number of taps of the horizontal kernel
+   @param[in]  pKerCol    points to the vertical kernel of length kerRows
+   @param[in]  kerRows    number of taps of the vertical kernel
+   @param[in]  padding    PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  pBuffer    points to a buffer of srcRows x (number of output columns) samples
+   @param[out] pDst       points to the output image
+   @param[in]  dstStride  number of elements between the starts of two output rows
+   @return     none
+
+   @par Separable kernels
+        The kernel is the outer product pKerCol x pKerRow. The image is first convolved with
+   pKerRow row by row into pBuffer (srcRows x number of output columns), then pBuffer is convolved
+   with pKerCol column by column. This takes kerRows + kerCols instead of kerRows * kerCols
+   multiplications per output.
+*/
+
+void plp_conv2d_sep_f32(const float32_t *pSrc,
+                        uint32_t srcRows,
+                        uint32_t srcCols,
+                        uint32_t srcStride,
+                        const float32_t *pKerRow,
+                        uint32_t kerCols,
+                        const float32_t *pKerCol,
+                        uint32_t kerRows,
+                        uint32_t padding,
+                        float32_t *pBuffer,
+                        float32_t *pDst,
+                        uint32_t dstStride) {
+
+    uint32_t padTop = 0, padLeft = 0;
+    uint32_t dstRows = srcRows - kerRows + 1;
+    uint32_t dstCols = srcCols - kerCols + 1;
+
+    if (padding == PLP_CONV2D_SAME) {
+        padTop = kerRows >> 1;
+        padLeft = kerCols >> 1;
+        dstRows = srcRows;
+        dstCols = srcCols;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_conv2d_instance_f32 H = { .pSrc = pSrc,
+                                      .srcRows = srcRows,
+                                      .srcCols = srcCols,
+                                      .srcStride = srcStride,
+                                      .pKernel = pKerRow,
+                                      .kerRows = 1,
+                                      .kerCols = kerCols,
+                                      .padTop = 0,
+                                      .padLeft = padLeft,
+                                      .dstRows = srcRows,
+                                      .dstCols = dstCols,
+                                      .dstStride = dstCols,
+                                      .nPE = 1,
+                                      .pDst = pBuffer };
+
+        plp_conv2d_f32s_xpulpv2(&H, 0, srcRows);
+        plp_conv2d_sep_f32s_xpulpv2(pBuffer, srcRows, pKerCol, kerRows, padTop, dstRows, dstCols,
+                                    pDst, dstStride);
+    }
+}
+
+/**
+   @} end of Conv2d group
+*/
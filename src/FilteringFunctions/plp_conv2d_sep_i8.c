@@ -0,0 +1,155 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_sep_i8.c
+ * Description:  8-bit integer separable 2D convolution glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Conv2d
+   @{
+*/
+
+/**
+   @brief Glue code for separable 2D convolution of 8-bit integer images.
+   @param[in]  pSrc       points to the input image
+   @param[in]  srcRows    number of rows of the input image
+   @param[in]  srcCols    number of columns of the input image
+   @param[in]  srcStride  number of elements between the starts of two input rows
+   @param[in]  pKerRow    points to the horizontal kernel of length kerCols
+   @param[in]  kerCols    number of taps of the horizontal kernel
+   @param[in]  pKerCol    points to the vertical kernel of length kerRows
+   @param[in]  kerRows    number of taps of the vertical kernel
+   @param[in]  padding    PLP_CONV2D_VALID or PLP_CONV2D_SAME
+   @param[in]  pBuffer    points to a buffer of srcRows x (number of output columns) samples
+   @param[out] pDst       points to the output image
+   @param[in]  dstStride  number of elements between the starts of two output rows
+   @return     none
+
+   @par Separable kernels
+        The kernel is the outer product pKerCol x pKerRow. The image is first convolved with
+   pKerRow row by row into pBuffer (srcRows x number of output columns), then pBuffer is convolved
+   with pKerCol column by column. This takes kerRows + kerCols instead of kerRows * kerCols
+   multiplications per output.
+*/
+
+void plp_conv2d_sep_i8(const int8_t *pSrc,
+                       uint32_t srcRows,
+                       uint32_t srcCols,
+                       uint32_t srcStride,
+                       const int8_t *pKerRow,
+                       uint32_t kerCols,
+                       const int8_t *pKerCol,
+                       uint32_t kerRows,
+                       uint32_t padding,
+                       int32_t *pBuffer,
+                       int32_t *pDst,
+                       uint32_t dstStride) {
+
+    uint32_t padTop = 0, padLeft = 0;
+    uint32_t dstRows = srcRows - kerRows + 1;
+    uint32_t dstCols = srcCols - kerCols + 1;
+
+    if (padding == PLP_CONV2D_SAME) {
+        padTop = kerRows >> 1;
+        padLeft = kerCols >> 1;
+        dstRows = srcRows;
+        dstCols = srcCols;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv2d_instance_i8 H = { .pSrc = pSrc,
+                                     .srcRows = srcRows,
+                                     .srcCols = srcCols,
+                                     .srcStride = srcStride,
+                                     .pKernel = pKerRow,
+                                     .kerRows = 1,
+                                     .kerCols = kerCols,
+                                     .padTop = 0,
+                                     .padLeft = padLeft,
+                                     .dstRows = srcRows,
+                                     .dstCols = dstCols,
+                                     .dstStride = dstCols,
+                                     .pKerFlip = NULL,
+                                     .nPE = 1,
+                                     .pScratch = NULL,
+                                     .scratchSizePE = 0,
+                                     .pDst = pBuffer };
+
+        plp_conv2d_i8s_rv32im(&H);
+        plp_conv2d_sep_i8s_rv32im(pBuffer, srcRows, pKerCol, kerRows, padTop, dstRows, dstCols,
+                                   pDst, dstStride);
+    } else {
+        uint32_t kerColsAl = (kerCols + 3) & ~3U;
+        uint32_t repLen = (dstCols - 1 + kerColsAl + 3) & ~3U;
+        uint32_t scratchSize = kerColsAl + 4 * repLen;
+        uint32_t c;
+
+        int8_t *pScratch = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * scratchSize);
+        if (pScratch == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+        int8_t *pKerFlip = pScratch;
+
+        // flip the horizontal kernel and zero-pad it to a multiple of 4 samples
+        for (c = 0; c < kerColsAl; c++) {
+            pKerFlip[c] = (c < kerCols) ? pKerRow[kerCols - 1 - c] : 0;
+        }
+
+        plp_conv2d_instance_i8 H = { .pSrc = pSrc,
+                                     .srcRows = srcRows,
+                                     .srcCols = srcCols,
+                                     .srcStride = srcStride,
+                                     .pKernel = pKerRow,
+                                     .kerRows = 1,
+                                     .kerCols = kerCols,
+                                     .padTop = 0,
+                                     .padLeft = padLeft,
+                                     .dstRows = srcRows,
+                                     .dstCols = dstCols,
+                                     .dstStride = dstCols,
+                                     .pKerFlip = pKerFlip,
+                                     .nPE = 1,
+                                     .pScratch = pScratch + kerColsAl,
+                                     .scratchSizePE = 0,
+                                     .pDst = pBuffer };
+
+        plp_conv2d_i8s_xpulpv2(&H, 0, srcRows, pScratch + kerColsAl);
+        plp_conv2d_sep_i8s_xpulpv2(pBuffer, srcRows, pKerCol, kerRows, padTop, dstRows, dstCols,
+                                    pDst, dstStride);
+
+        rt_free(RT_ALLOC_CL_DATA, pScratch, sizeof(int8_t) * scratchSize);
+    }
+}
+
+/**
+   @} end of Conv2d group
+*/
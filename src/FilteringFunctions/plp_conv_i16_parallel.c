@@ -31,7 +31,9 @@
 #include "plp_math.h"
 #include "rt/rt_api.h"
 
+#if defined(PLP_CONV_PARALLEL_OLA)
 RT_CL_DATA int32_t *resultsBuffer;
+#endif
 
 /**
    @ingroup groupFilters
@@ -51,6 +53,10 @@ RT_CL_DATA int32_t *resultsBuffer;
    @param[in]  nPE       Number of cores to compute on
    @param[out] pRes     output result returned here
    @return        none
+   @par Partitioning
+        By default the output vector is split into contiguous ranges, one per core, and each core
+   writes its samples directly into pRes. Define PLP_CONV_PARALLEL_OLA to select the former
+   scheme, i.e. partial convolutions in an L1 buffer followed by an overlap-add step.
 */
 
 void plp_conv_i16_parallel(const int16_t *pSrcA,
@@ -65,6 +71,31 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
         return;
     } else {
 
+#if !defined(PLP_CONV_PARALLEL_OLA)
+
+        /* Output partitioning: every core computes a disjoint range of pRes, no scratch needed */
+        plp_conv_instance_i16 S;
+
+        if (srcALen >= srcBLen) {
+            S = (plp_conv_instance_i16){ .pSrcA = pSrcA,
+                                         .srcALen = srcALen,
+                                         .pSrcB = pSrcB,
+                                         .srcBLen = srcBLen,
+                                         .nPE = nPE,
+                                         .pRes = pRes };
+        } else {
+            S = (plp_conv_instance_i16){ .pSrcA = pSrcB,
+                                         .srcALen = srcBLen,
+                                         .pSrcB = pSrcA,
+                                         .srcBLen = srcALen,
+                                         .nPE = nPE,
+                                         .pRes = pRes };
+        }
+
+        rt_team_fork(nPE, plp_conv_outpart_i16p_xpulpv2, (void *)&S);
+
+#else /* PLP_CONV_PARALLEL_OLA */
+
         const int16_t *pIn1;
         const int16_t *pIn2;
 
@@ -164,6 +195,8 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
 #endif
         }
 
+#endif /* PLP_CONV_PARALLEL_OLA */
+
         return;
     }
 }
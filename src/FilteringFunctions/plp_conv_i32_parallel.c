@@ -31,7 +31,9 @@
 #include "plp_math.h"
 #include "rt/rt_api.h"
 
+#if defined(PLP_CONV_PARALLEL_OLA)
 RT_CL_DATA int32_t *resultsBuffer;
+#endif
 
 /**
    @ingroup groupFilters
@@ -51,6 +53,10 @@ RT_CL_DATA int32_t *resultsBuffer;
    @param[in]  nPE       Number of cores to compute on
    @param[out] pRes     output result returned here
    @return        none
+   @par Partitioning
+        By default the output vector is split into contiguous ranges, one per core, and each core
+   writes its samples directly into pRes. Define PLP_CONV_PARALLEL_OLA to select the former
+   scheme, i.e. partial convolutions in an L1 buffer followed by an overlap-add step.
 */
 
 //#define PLP_CONV_SEQUENTIALADDING 1
@@ -67,6 +73,31 @@ void plp_conv_i32_parallel(const int32_t *pSrcA,
         return;
     } else {
 
+#if !defined(PLP_CONV_PARALLEL_OLA)
+
+        /* Output partitioning: every core computes a disjoint range of pRes, no scratch needed */
+        plp_conv_instance_i32 S;
+
+        if (srcALen >= srcBLen) {
+            S = (plp_conv_instance_i32){ .pSrcA = pSrcA,
+                                         .srcALen = srcALen,
+                                         .pSrcB = pSrcB,
+                                         .srcBLen = srcBLen,
+                                         .nPE = nPE,
+                                         .pRes = pRes };
+        } else {
+            S = (plp_conv_instance_i32){ .pSrcA = pSrcB,
+                                         .srcALen = srcBLen,
+                                         .pSrcB = pSrcA,
+                                         .srcBLen = srcALen,
+                                         .nPE = nPE,
+                                         .pRes = pRes };
+        }
+
+        rt_team_fork(nPE, plp_conv_outpart_i32p_xpulpv2, (void *)&S);
+
+#else /* PLP_CONV_PARALLEL_OLA */
+
         if (nPE == 1) {
             plp_conv_i32(pSrcA, srcALen, pSrcB, srcBLen, pRes);
             return;
@@ -177,6 +208,8 @@ void plp_conv_i32_parallel(const int32_t *pSrcA,
 
 #endif
         }
+#endif /* PLP_CONV_PARALLEL_OLA */
+
         return;
     }
 }
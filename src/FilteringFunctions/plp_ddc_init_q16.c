@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ddc_init_q16.c
+ * Description:  16-bit fixed point digital down-converter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup DDC Digital Down-Conversion
+   Translates a complex signal to baseband, low-pass filters it and decimates it by D in one pass.
+   Every input sample is multiplied with the numerically controlled oscillator exp(j*phase) (see
+   @ref plp_nco_mix_q16) and appended to the delay lines of the in-phase and quadrature
+   components. The real-valued low-pass filter is then evaluated on both delay lines only at the
+   samples that are kept after decimation, so no output is computed and thrown away.
+
+   The instance keeps the last numTaps-1 mixed samples of both components in the state buffer,
+   followed by the current input block, so every output is a contiguous dot product. The
+   decimation phase and the oscillator phase are carried over from one block to the next, hence
+   the block size does not have to be a multiple of D.
+
+   The _parallel variant processes several independent channels (each with its own instance) and
+   distributes the channels over the cores.
+*/
+
+/**
+   @addtogroup DDC
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point digital down-converter.
+   @param[out] S            points to an instance of the down-converter structure
+   @param[in]  numTaps      number of taps of the low-pass filter
+   @param[in]  decimFactor  decimation factor D
+   @param[in]  pTaps        points to the Q1.15 low-pass filter taps in natural order
+   @param[in]  pCoeffs      points to the coefficient buffer of numTaps samples
+   @param[in]  pState       points to the state buffer of 2*(numTaps-1+blockSize) samples
+   @param[in]  blockSize    maximum number of complex input samples per call
+   @param[in]  phaseInc     oscillator phase increment per input sample, a full turn is 2^32. To
+                            move a carrier at f down to DC, use -f / fs * 2^32.
+   @param[in]  deciPoint    decimal point for right shift of the filter output
+   @return     none
+
+   @par Coefficient layout
+        pCoeffs holds the taps in reversed order, such that they can be applied directly to the
+   chronologically ordered delay lines.
+*/
+
+void plp_ddc_init_q16(plp_ddc_instance_q16 *S,
+                      uint16_t numTaps,
+                      uint16_t decimFactor,
+                      const int16_t *pTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      uint32_t blockSize,
+                      uint32_t phaseInc,
+                      uint32_t deciPoint) {
+
+    uint32_t k;
+
+    for (k = 0; k < numTaps; k++) {
+        pCoeffs[k] = pTaps[numTaps - 1 - k];
+    }
+
+    // in-phase history at the start, quadrature history after the in-phase delay line
+    for (k = 0; k + 1 < numTaps; k++) {
+        pState[k] = 0;
+        pState[numTaps - 1 + blockSize + k] = 0;
+    }
+
+    plp_nco_init_q16(&S->nco, phaseInc, 0);
+
+    S->numTaps = numTaps;
+    S->decimFactor = decimFactor;
+    S->blockSize = blockSize;
+    S->index = 0;
+    S->deciPoint = deciPoint;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+}
+
+/**
+   @} end of DDC group
+*/
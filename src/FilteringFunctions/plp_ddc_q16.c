@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ddc_q16.c
+ * Description:  16-bit fixed point digital down-converter glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup DDC
+   @{
+*/
+
+/**
+   @brief Glue code for digital down-conversion of 16-bit fixed point complex vectors.
+   @param[in]  S          points to an instance of the down-converter structure
+   @param[in]  pSrc       points to the Q1.15 complex input block
+   @param[in]  blockSize  number of complex input samples, at most the one given at init
+   @param[out] pDst       points to the complex output block, at most ceil(blockSize/D) samples
+   @param[out] pDstLen    number of complex output samples written to pDst
+   @return     none
+*/
+
+void plp_ddc_q16(plp_ddc_instance_q16 *S,
+                 const int16_t *pSrc,
+                 uint32_t blockSize,
+                 int16_t *pDst,
+                 uint32_t *pDstLen) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_ddc_q16s_rv32im(S, pSrc, blockSize, pDst, pDstLen);
+    } else {
+        plp_ddc_q16s_xpulpv2(S, pSrc, blockSize, pDst, pDstLen);
+    }
+}
+
+/**
+   @} end of DDC group
+*/
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_ddc_q16_parallel.c
+ * Description:  16-bit fixed point parallel multi-channel digital down-converter glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup DDC
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel multi-channel 16-bit fixed point digital down-converter.
+   @param[in]  S          points to an array of nChannels instances, one per channel
+   @param[in]  nChannels  number of channels
+   @param[in]  pSrc       points to the complex input samples, channel after channel
+   @param[in]  blockSize  number of complex input samples per channel
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pDst       points to the complex output samples, the output of channel ch starts
+                          at pDst + 2*ch*ceil(blockSize/D)
+   @param[out] pDstLen    points to nChannels output lengths, one per channel
+   @return     none
+
+   @par Parallelization
+        The channels are independent, so they are distributed over the cores in a round robin
+   fashion and every core down-converts whole channels. All channels must use the same
+   decimation factor, while oscillator frequency and filter taps may differ.
+*/
+
+void plp_ddc_q16_parallel(plp_ddc_instance_q16 *S,
+                          uint32_t nChannels,
+                          const int16_t *pSrc,
+                          uint32_t blockSize,
+                          uint8_t nPE,
+                          int16_t *pDst,
+                          uint32_t *pDstLen) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_ddc_instance_q16_parallel P = { .S = S,
+                                            .nChannels = nChannels,
+                                            .pSrc = pSrc,
+                                            .blockSize = blockSize,
+                                            .nPE = nPE,
+                                            .pDst = pDst,
+                                            .pDstLen = pDstLen };
+
+        rt_team_fork(nPE, plp_ddc_q16p_xpulpv2, (void *)&P);
+    }
+}
+
+/**
+   @} end of DDC group
+*/
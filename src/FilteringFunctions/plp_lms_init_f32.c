@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_init_f32.c
+ * Description:  32-bit floating point LMS filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup LMS
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit float LMS adaptive filter.
+   @param[out] S        points to an instance of the LMS structure
+   @param[in]  numTaps  number of filter coefficients
+   @param[in]  pCoeffs  points to the initial coefficients (time reversed)
+   @param[in]  pState   points to the state buffer, numTaps+blockSize samples
+   @param[in]  mu       step size
+   @return     none
+*/
+
+void plp_lms_init_f32(plp_lms_instance_f32 *S,
+                      uint16_t numTaps,
+                      float32_t *pCoeffs,
+                      float32_t *pState,
+                      float32_t mu) {
+
+    uint32_t k;
+
+    for (k = 0; k < numTaps; k++) {
+        pState[k] = 0.0f;
+    }
+
+    S->numTaps = numTaps;
+    S->pState = pState;
+    S->pCoeffs = pCoeffs;
+    S->mu = mu;
+    S->gain = 0.0f;
+}
+
+/**
+   @} end of LMS group
+*/
@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16.c
+ * Description:  16-bit integer median filter glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup MedianFilter
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit integer median filter.
+   @param[in]  S          points to an instance of the median filter structure
+   @param[in]  pSrc       points to the block of input samples
+   @param[out] pDst       points to the block of output samples
+   @param[in]  blockSize  number of samples to process
+   @return     none
+*/
+
+void plp_median_filter_i16(plp_median_filter_instance_i16 *S,
+                           const int16_t *pSrc,
+                           int16_t *pDst,
+                           uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_median_filter_i16s_rv32im(S, pSrc, pDst, blockSize);
+    } else {
+        plp_median_filter_i16s_xpulpv2(S, pSrc, pDst, blockSize);
+    }
+}
+
+/**
+   @} end of MedianFilter group
+*/
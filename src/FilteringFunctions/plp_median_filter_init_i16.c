@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_init_i16.c
+ * Description:  16-bit integer median filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup MedianFilter Median Filter
+   Streaming median over the last winLen samples. Besides the ring buffer of the window, the
+   instance keeps the same samples in ascending order. For every new sample, the position of the
+   sample leaving the window is found with a binary search and the new sample is slid from there
+   to its sorted position, hence no sorting is needed. The output is pSorted[winLen / 2], i.e. the
+   median for odd window lengths. The window initially holds zeros.
+
+   The _parallel variant filters several independent channels (each with its own instance) and
+   distributes the channels over the cores.
+*/
+
+/**
+   @addtogroup MedianFilter
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit integer median filter.
+   @param[out] S        points to an instance of the median filter structure
+   @param[in]  winLen   number of samples in the window
+   @param[in]  pState   points to the state buffer of winLen samples
+   @param[in]  pSorted  points to the sorted window buffer of winLen samples
+   @return     none
+*/
+
+void plp_median_filter_init_i16(plp_median_filter_instance_i16 *S,
+                                uint16_t winLen,
+                                int16_t *pState,
+                                int16_t *pSorted) {
+
+    uint32_t k;
+
+    for (k = 0; k < winLen; k++) {
+        pState[k] = 0;
+        pSorted[k] = 0;
+    }
+
+    S->winLen = winLen;
+    S->index = 0;
+    S->pState = pState;
+    S->pSorted = pSorted;
+}
+
+/**
+   @} end of MedianFilter group
+*/
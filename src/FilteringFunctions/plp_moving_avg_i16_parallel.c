@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_i16_parallel.c
+ * Description:  16-bit integer parallel multi-channel moving average filter glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup MovingAvg
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel multi-channel 16-bit integer moving average filter.
+   @param[in]  S          points to an array of nChannels instances, one per channel
+   @param[in]  nChannels  number of channels
+   @param[in]  pSrc       points to the input samples, channel after channel
+   @param[out] pDst       points to the output samples, same layout as pSrc
+   @param[in]  blockSize  number of samples per channel
+   @param[in]  nPE        number of cores to compute on
+   @return     none
+
+   @par Parallelization
+        The channels are independent, so they are distributed over the cores in a round robin
+   fashion and every core filters whole channels.
+*/
+
+void plp_moving_avg_i16_parallel(plp_moving_avg_instance_i16 *S,
+                                 uint32_t nChannels,
+                                 const int16_t *pSrc,
+                                 int16_t *pDst,
+                                 uint32_t blockSize,
+                                 uint8_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_moving_avg_instance_i16_parallel P = { .S = S,
+                                                   .nChannels = nChannels,
+                                                   .pSrc = pSrc,
+                                                   .pDst = pDst,
+                                                   .blockSize = blockSize,
+                                                   .nPE = nPE };
+
+        rt_team_fork(nPE, plp_moving_avg_i16p_xpulpv2, (void *)&P);
+    }
+}
+
+/**
+   @} end of MovingAvg group
+*/
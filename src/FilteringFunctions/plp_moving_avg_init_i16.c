@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_init_i16.c
+ * Description:  16-bit integer moving average filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup MovingAvg Moving Average Filter
+   Streaming moving average over the last winLen samples. The instance keeps the window in a ring
+   buffer together with its running sum, so every sample costs one addition, one subtraction and
+   one division independent of winLen. The window initially holds zeros. The running sum of the
+   32-bit version is 64-bit wide, since the sum of a full scale window does not fit 32 bits.
+
+   The _parallel variant filters several independent channels (each with its own instance) and
+   distributes the channels over the cores.
+*/
+
+/**
+   @addtogroup MovingAvg
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit integer moving average filter.
+   @param[out] S       points to an instance of the moving average filter structure
+   @param[in]  winLen  number of samples in the window
+   @param[in]  pState  points to the state buffer of winLen samples
+   @return     none
+*/
+
+void plp_moving_avg_init_i16(plp_moving_avg_instance_i16 *S,
+                             uint16_t winLen,
+                             int16_t *pState) {
+
+    uint32_t k;
+
+    for (k = 0; k < winLen; k++) {
+        pState[k] = 0;
+    }
+
+    S->winLen = winLen;
+    S->index = 0;
+    S->pState = pState;
+    S->sum = 0;
+}
+
+/**
+   @} end of MovingAvg group
+*/
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_moving_avg_init_i32.c
+ * Description:  32-bit integer moving average filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup MovingAvg
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit integer moving average filter.
+   @param[out] S       points to an instance of the moving average filter structure
+   @param[in]  winLen  number of samples in the window
+   @param[in]  pState  points to the state buffer of winLen samples
+   @return     none
+*/
+
+void plp_moving_avg_init_i32(plp_moving_avg_instance_i32 *S,
+                             uint16_t winLen,
+                             int32_t *pState) {
+
+    uint32_t k;
+
+    for (k = 0; k < winLen; k++) {
+        pState[k] = 0;
+    }
+
+    S->winLen = winLen;
+    S->index = 0;
+    S->pState = pState;
+    S->sum = 0;
+}
+
+/**
+   @} end of MovingAvg group
+*/
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nlms_init_q16.c
+ * Description:  16-bit fixed point NLMS filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup NLMS Normalized LMS Filters
+   LMS filter whose step size is normalized by the energy of the samples in the filter window:
+
+       w[k] = w[k] + mu * e[n] * x[n-k] / (x[n]^2 + ... + x[n-numTaps+1]^2)
+
+   The energy is tracked incrementally sample by sample. As for the LMS filter, the coefficient
+   update is fused with the output of the next sample and the update due to the last sample of a
+   block is applied while processing the next block.
+*/
+
+/**
+   @addtogroup NLMS
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point normalized LMS adaptive filter.
+   @param[out] S          points to an instance of the NLMS structure
+   @param[in]  numTaps    number of filter coefficients
+   @param[in]  pCoeffs    points to the initial coefficients (time reversed)
+   @param[in]  pState     points to the state buffer, numTaps+blockSize samples
+   @param[in]  mu         step size
+   @param[in]  deciPoint  decimal point for right shift
+   @return     none
+*/
+
+void plp_nlms_init_q16(plp_nlms_instance_q16 *S,
+                       uint16_t numTaps,
+                       int16_t *pCoeffs,
+                       int16_t *pState,
+                       int16_t mu,
+                       uint32_t deciPoint) {
+
+    uint32_t k;
+
+    for (k = 0; k < numTaps; k++) {
+        pState[k] = 0;
+    }
+
+    S->numTaps = numTaps;
+    S->pState = pState;
+    S->pCoeffs = pCoeffs;
+    S->mu = mu;
+    S->deciPoint = deciPoint;
+    S->energy = 0;
+    S->gain = 0;
+}
+
+/**
+   @} end of NLMS group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nlms_init_q32.c
+ * Description:  32-bit fixed point NLMS filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup NLMS
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit fixed point normalized LMS adaptive filter.
+   @param[out] S          points to an instance of the NLMS structure
+   @param[in]  numTaps    number of filter coefficients
+   @param[in]  pCoeffs    points to the initial coefficients (time reversed)
+   @param[in]  pState     points to the state buffer, numTaps+blockSize samples
+   @param[in]  mu         step size
+   @param[in]  deciPoint  decimal point for right shift
+   @return     none
+*/
+
+void plp_nlms_init_q32(plp_nlms_instance_q32 *S,
+                       uint16_t numTaps,
+                       int32_t *pCoeffs,
+                       int32_t *pState,
+                       int32_t mu,
+                       uint32_t deciPoint) {
+
+    uint32_t k;
+
+    for (k = 0; k < numTaps; k++) {
+        pState[k] = 0;
+    }
+
+    S->numTaps = numTaps;
+    S->pState = pState;
+    S->pCoeffs = pCoeffs;
+    S->mu = mu;
+    S->deciPoint = deciPoint;
+    S->energy = 0;
+    S->gain = 0;
+}
+
+/**
+   @} end of NLMS group
+*/
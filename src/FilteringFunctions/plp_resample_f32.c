@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_f32.c
+ * Description:  32-bit floating point polyphase resampler glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Resample
+   @{
+*/
+
+/**
+   @brief Glue code for polyphase resampling of 32-bit float vectors.
+   @param[in]  S          points to an instance of the resampler structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  blockSize  number of input samples
+   @param[out] pDst       points to the output block, at most ceil(blockSize*L/M) samples
+   @param[out] pDstLen    number of output samples written to pDst
+   @return     none
+*/
+
+void plp_resample_f32(plp_resample_instance_f32 *S,
+                      const float32_t *pSrc,
+                      uint32_t blockSize,
+                      float32_t *pDst,
+                      uint32_t *pDstLen) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_resample_f32s_xpulpv2(S, pSrc, blockSize, pDst, pDstLen);
+    }
+}
+
+/**
+   @} end of Resample group
+*/
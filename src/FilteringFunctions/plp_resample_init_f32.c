@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_init_f32.c
+ * Description:  32-bit floating point polyphase resampler initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Resample
+   @{
+*/
+
+/**
+   @brief Initialization of the floating-point polyphase resampler.
+   @param[out] S           points to an instance of the resampler structure
+   @param[in]  upFactor    interpolation factor L
+   @param[in]  downFactor  decimation factor M
+   @param[in]  numTaps     number of taps of the prototype filter
+   @param[in]  pProto      points to the prototype low-pass filter
+   @param[in]  pCoeffs     points to the sub-filter buffer, L*ceil(numTaps/L) samples
+   @param[in]  pState      points to the state buffer, ceil(numTaps/L)-1+blockSize samples
+   @return     none
+
+   @par Coefficient layout
+        Sub-filter p holds the taps pProto[p + k*L], k = 0 .. phaseLen-1, in reversed order and
+   zero-padded to phaseLen, such that it can be applied directly to the chronologically ordered
+   state buffer.
+*/
+
+void plp_resample_init_f32(plp_resample_instance_f32 *S,
+                           uint16_t upFactor,
+                           uint16_t downFactor,
+                           uint32_t numTaps,
+                           const float32_t *pProto,
+                           float32_t *pCoeffs,
+                           float32_t *pState) {
+
+    uint32_t phaseLen = (numTaps + upFactor - 1) / upFactor;
+    uint32_t p, k, tap;
+
+    for (p = 0; p < upFactor; p++) {
+        for (k = 0; k < phaseLen; k++) {
+            tap = p + (phaseLen - 1 - k) * upFactor;
+            pCoeffs[p * phaseLen + k] = (tap < numTaps) ? pProto[tap] : 0.0f;
+        }
+    }
+
+    for (k = 0; k + 1 < phaseLen; k++) {
+        pState[k] = 0.0f;
+    }
+
+    S->upFactor = upFactor;
+    S->downFactor = downFactor;
+    S->phaseLen = phaseLen;
+    S->phase = 0;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+}
+
+/**
+   @} end of Resample group
+*/
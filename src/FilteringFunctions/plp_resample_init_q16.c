@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_init_q16.c
+ * Description:  16-bit fixed point polyphase resampler initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup Resample Polyphase Resampling
+   Changes the sampling rate of a signal by the rational factor L/M. The input is (conceptually)
+   upsampled by L, filtered by a prototype low-pass filter and downsampled by M. Instead of
+   zero-stuffing, the prototype is split into L polyphase sub-filters and only the sub-filter that
+   contributes to the next output sample is evaluated, so no multiplication by zero is performed.
+
+   The prototype filter runs at L times the input rate. Its cut-off frequency must be at most
+   min(pi/L, pi/M) and its DC gain should be L to preserve the signal amplitude.
+
+   The instance keeps the last ceil(numTaps/L)-1 input samples in the state buffer, followed by the
+   current input block, so every sub-filter is evaluated as a contiguous dot product.
+*/
+
+/**
+   @addtogroup Resample
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed point polyphase resampler.
+   @param[out] S           points to an instance of the resampler structure
+   @param[in]  upFactor    interpolation factor L
+   @param[in]  downFactor  decimation factor M
+   @param[in]  numTaps     number of taps of the prototype filter
+   @param[in]  pProto      points to the prototype low-pass filter
+   @param[in]  pCoeffs     points to the sub-filter buffer, L*ceil(numTaps/L) samples
+   @param[in]  pState      points to the state buffer, ceil(numTaps/L)-1+blockSize samples
+   @param[in]  deciPoint   decimal point for right shift
+   @return     none
+
+   @par Coefficient layout
+        Sub-filter p holds the taps pProto[p + k*L], k = 0 .. phaseLen-1, in reversed order and
+   zero-padded to phaseLen, such that it can be applied directly to the chronologically ordered
+   state buffer.
+*/
+
+void plp_resample_init_q16(plp_resample_instance_q16 *S,
+                           uint16_t upFactor,
+                           uint16_t downFactor,
+                           uint32_t numTaps,
+                           const int16_t *pProto,
+                           int16_t *pCoeffs,
+                           int16_t *pState,
+                           uint32_t deciPoint) {
+
+    uint32_t phaseLen = (numTaps + upFactor - 1) / upFactor;
+    uint32_t p, k, tap;
+
+    for (p = 0; p < upFactor; p++) {
+        for (k = 0; k < phaseLen; k++) {
+            tap = p + (phaseLen - 1 - k) * upFactor;
+            pCoeffs[p * phaseLen + k] = (tap < numTaps) ? pProto[tap] : 0;
+        }
+    }
+
+    for (k = 0; k + 1 < phaseLen; k++) {
+        pState[k] = 0;
+    }
+
+    S->upFactor = upFactor;
+    S->downFactor = downFactor;
+    S->phaseLen = phaseLen;
+    S->phase = 0;
+    S->deciPoint = deciPoint;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+}
+
+/**
+   @} end of Resample group
+*/
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_q16_parallel.c
+ * Description:  16-bit fixed point parallel polyphase resampler glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Resample
+   @{
+*/
+
+/**
+   @brief Glue code for parallel polyphase resampling of 16-bit fixed point vectors.
+   @param[in]  S          points to an instance of the resampler structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  blockSize  number of input samples
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pDst       points to the output block, at most ceil(blockSize*L/M) samples
+   @param[out] pDstLen    number of output samples written to pDst
+   @return     none
+
+   @par Parallelization
+        The number of output samples of the block is known in advance, hence the outputs are split
+   into contiguous ranges, one per core. The sub-filter and the input window of the first output
+   of each range are computed directly from its position on the upsampled grid.
+*/
+
+void plp_resample_q16_parallel(plp_resample_instance_q16 *S,
+                               const int16_t *pSrc,
+                               uint32_t blockSize,
+                               uint8_t nPE,
+                               int16_t *pDst,
+                               uint32_t *pDstLen) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint32_t upLen = blockSize * S->upFactor;
+        uint32_t nOut = 0;
+        uint32_t k;
+
+        if (S->phase < upLen) {
+            nOut = (upLen - S->phase + S->downFactor - 1) / S->downFactor;
+        }
+
+        plp_resample_instance_q16_parallel P = { .S = S,
+                                                 .pSrc = pSrc,
+                                                 .blockSize = blockSize,
+                                                 .nOut = nOut,
+                                                 .nPE = nPE,
+                                                 .pDst = pDst };
+
+        rt_team_fork(nPE, plp_resample_q16p_xpulpv2, (void *)&P);
+
+        S->phase = S->phase + nOut * S->downFactor - upLen;
+
+        // keep the last phaseLen-1 input samples for the next block
+        for (k = 0; k + 1 < S->phaseLen; k++) {
+            S->pState[k] = S->pState[blockSize + k];
+        }
+
+        *pDstLen = nOut;
+    }
+}
+
+/**
+   @} end of Resample group
+*/
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_cmplx_f32p_xpulpv2.c
+ * Description:  Parallel complex Hermitian rank-1 update kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatHerkCmplx
+ */
+
+/**
+  @addtogroup MatHerkCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Parallel Hermitian rank-1 update for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_herk_cmplx_instance_f32 struct initialized by
+                    plp_mat_herk_cmplx_f32_parallel
+  @return     none
+ */
+
+void plp_mat_herk_cmplx_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_herk_cmplx_instance_f32 *a = (plp_mat_herk_cmplx_instance_f32 *)args;
+
+    const float *__restrict__ pSrcX = a->pSrcX;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstR = a->pDstR;
+
+    for (int i = core_id; i < N; i += nPE) {
+        float xi_re = pSrcX[i * 2 + 0];
+        float xi_im = pSrcX[i * 2 + 1];
+        float *pRow = &pDstR[i * N * 2];
+        for (int j = i; j < N; j++) {
+            float xj_re = pSrcX[j * 2 + 0];
+            float xj_im = pSrcX[j * 2 + 1];
+            pRow[j * 2 + 0] += xi_re * xj_re + xi_im * xj_im;
+            pRow[j * 2 + 1] += xi_im * xj_re - xi_re * xj_im;
+        }
+    }
+}
+
+/**
+   @} end of MatHerkCmplxKernels group
+*/
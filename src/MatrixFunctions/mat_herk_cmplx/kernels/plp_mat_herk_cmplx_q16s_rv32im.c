@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_cmplx_q16s_rv32im.c
+ * Description:  Complex Hermitian rank-1 update kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatHerkCmplx
+ */
+
+/**
+  @defgroup MatHerkCmplxKernels Complex Hermitian Rank-1 Update Kernels
+  This module contains the kernels for complex Hermitian rank-1 update.
+
+  The Hermitian Rank-1 Update adds the outer product of the column vector x of length N with
+  its own conjugate transpose to the Hermitian matrix R with shape NxN, as done for every
+  snapshot when estimating a covariance matrix.
+
+      pDstR[i,j] += pSrcX[i] * conj(pSrcX[j])        for j >= i
+
+  Since R is Hermitian, only its upper triangle (including the diagonal) is updated. The
+  strictly lower triangle is neither read nor written, and is given by
+  `R[j,i] = conj(R[i,j])`.
+
+  These functions assume all matrices and vectors to be complex. They must be stored such that
+  real and imaginary part of any element are directly next to each other. The dimensionality
+  (`M`, `N`, `O`) still counts the number of elements in each dimension, such that a complex
+  matrix X with shape MxN has size `M * N * 2`. To access the real and imaginary part of this
+  matrix `X`, do:
+
+      Re(X[m, n]): pX[(m * N + n) * 2]
+      Im(X[m, n]): pX[(m * N + n) * 2 + 1]
+
+  There are functions for 32- and 16-bit fix-point and for 32-bit floating point data types.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_herk_cmplx_q32s_xpulpv2`):
+
+      plp_<function name>_<data type><precision><method>_<isa_extension>
+
+  name          | description
+  ------------- | ---------------------------------------------------------------------------
+  function_name | `mat_herk_cmplx`
+  data type     | {`f`, `q`} respectively for floats and fixed points
+  precision     | {`32`, `16`} bits
+  method        | {`s`, `p`} meaning scalar and parallel, respectively
+  isa_extension | {`rv32im`, `xpulpv2`} respectively for ibex and riscy
+ */
+
+/**
+  @addtogroup MatHerkCmplxKernels
+  @{
+ */
+
+/**
+  @brief         Hermitian rank-1 update for complex 16-bit fix-point on RV32IM
+  @param[in]     pSrcX Points to the input vector of length N
+  @param[in]     N     Length of vector SrcX, and height and width of matrix DstR
+  @param[in]     shift Amount to shift the result of each multiplication to the right
+  @param[in,out] pDstR Points to the Hermitian matrix of shape NxN, only its upper
+                       triangle is updated
+  @return        none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is added
+  to R. Assume that vector x has `x` bits after the binary point. Then, matrix R must have
+  `2 * x - shift` bits after the binary point. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_herk_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcX,
+                                    uint32_t N,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstR) {
+
+    int32_t bias = (1 << shift) >> 1; // round to nearest
+
+    for (int i = 0; i < N; i++) {
+        int32_t xi_re = pSrcX[i * 2 + 0];
+        int32_t xi_im = pSrcX[i * 2 + 1];
+        int16_t *pRow = &pDstR[i * N * 2];
+        for (int j = i; j < N; j++) {
+            int32_t xj_re = pSrcX[j * 2 + 0];
+            int32_t xj_im = pSrcX[j * 2 + 1];
+            pRow[j * 2 + 0] += (xi_re * xj_re + xi_im * xj_im + bias) >> shift;
+            pRow[j * 2 + 1] += (xi_im * xj_re - xi_re * xj_im + bias) >> shift;
+        }
+    }
+}
+
+/**
+   @} end of MatHerkCmplxKernels group
+*/
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_cmplx_q16s_xpulpv2.c
+ * Description:  Complex Hermitian rank-1 update kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatHerkCmplx
+ */
+
+/**
+  @addtogroup MatHerkCmplxKernels
+  @{
+ */
+
+/**
+  @brief         Hermitian rank-1 update for complex 16-bit fix-point on XpulpV2
+  @param[in]     pSrcX Points to the input vector of length N
+  @param[in]     N     Length of vector SrcX, and height and width of matrix DstR
+  @param[in]     shift Amount to shift the result of each multiplication to the right
+  @param[in,out] pDstR Points to the Hermitian matrix of shape NxN, only its upper
+                       triangle is updated
+  @return        none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is added
+  to R. Assume that vector x has `x` bits after the binary point. Then, matrix R must have
+  `2 * x - shift` bits after the binary point. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_herk_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                                     uint32_t N,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstR) {
+
+    for (int i = 0; i < N; i++) {
+        int32_t xi_re = pSrcX[i * 2 + 0];
+        int32_t xi_im = pSrcX[i * 2 + 1];
+        int16_t *pRow = &pDstR[i * N * 2];
+        for (int j = i; j < N; j++) {
+            int32_t xj_re = pSrcX[j * 2 + 0];
+            int32_t xj_im = pSrcX[j * 2 + 1];
+            pRow[j * 2 + 0] += __ROUNDNORM_REG(xi_re * xj_re + xi_im * xj_im, shift);
+            pRow[j * 2 + 1] += __ROUNDNORM_REG(xi_im * xj_re - xi_re * xj_im, shift);
+        }
+    }
+}
+
+/**
+   @} end of MatHerkCmplxKernels group
+*/
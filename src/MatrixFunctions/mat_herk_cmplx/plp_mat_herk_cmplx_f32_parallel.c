@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_cmplx_f32_parallel.c
+ * Description:  Parallel complex Hermitian rank-1 update glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatHerkCmplx
+  @{
+ */
+
+/**
+  @brief         Glue code of parallel Hermitian rank-1 update for complex 32-bit floats
+  @param[in]     pSrcX Points to the input vector of length N
+  @param[in]     N     Length of vector SrcX, and height and width of matrix DstR
+  @param[in]     nPE   Number of cores to use for computation
+  @param[in,out] pDstR Points to the Hermitian matrix of shape NxN, only its upper
+                       triangle is updated
+  @return        none
+ */
+
+void plp_mat_herk_cmplx_f32_parallel(const float *__restrict__ pSrcX,
+                                     uint32_t N,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_herk_cmplx_instance_f32 args = { .pSrcX = pSrcX,
+                                                 .N = N,
+                                                 .nPE = nPE,
+                                                 .pDstR = pDstR };
+
+        rt_team_fork(nPE, plp_mat_herk_cmplx_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatHerkCmplx group
+ */
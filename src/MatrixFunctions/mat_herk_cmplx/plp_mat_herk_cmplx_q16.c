@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_cmplx_q16.c
+ * Description:  Complex Hermitian rank-1 update glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatHerkCmplx Complex Hermitian Rank-1 Update
+  This module contains the glue code for complex Hermitian rank-1 update. The kernel codes
+  (kernels) are in the Module @ref MatHerkCmplxKernels.
+
+  The Hermitian Rank-1 Update adds the outer product of the column vector x of length N with
+  its own conjugate transpose to the Hermitian matrix R with shape NxN, as done for every
+  snapshot when estimating a covariance matrix.
+
+      pDstR[i,j] += pSrcX[i] * conj(pSrcX[j])        for j >= i
+
+  Since R is Hermitian, only its upper triangle (including the diagonal) is updated. The
+  strictly lower triangle is neither read nor written, and is given by
+  `R[j,i] = conj(R[i,j])`.
+
+  These functions assume all matrices and vectors to be complex. They must be stored such that
+  real and imaginary part of any element are directly next to each other. The dimensionality
+  (`M`, `N`, `O`) still counts the number of elements in each dimension, such that a complex
+  matrix X with shape MxN has size `M * N * 2`. To access the real and imaginary part of this
+  matrix `X`, do:
+
+      Re(X[m, n]): pX[(m * N + n) * 2]
+      Im(X[m, n]): pX[(m * N + n) * 2 + 1]
+
+  There are functions for 32- and 16-bit fix-point and for 32-bit floating point data types.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_herk_cmplx_q32`):
+
+      plp_<function name>_<data type><precision>[_parallel]
+
+  name          | description
+  ------------- | ---------------------------------------------------------
+  function_name | `mat_herk_cmplx`
+  data type     | {f, q} respectively for floats and fixed points
+  precision     | {32, 16} bits
+ */
+
+/**
+  @addtogroup MatHerkCmplx
+  @{
+ */
+
+/**
+  @brief         Glue code of Hermitian rank-1 update for complex 16-bit fix-point
+  @param[in]     pSrcX Points to the input vector of length N
+  @param[in]     N     Length of vector SrcX, and height and width of matrix DstR
+  @param[in]     shift Amount to shift the result of each multiplication to the right
+  @param[in,out] pDstR Points to the Hermitian matrix of shape NxN, only its upper
+                       triangle is updated
+  @return        none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is added
+  to R. Assume that vector x has `x` bits after the binary point. Then, matrix R must have
+  `2 * x - shift` bits after the binary point. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_herk_cmplx_q16(const int16_t *__restrict__ pSrcX,
+                            uint32_t N,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_herk_cmplx_q16s_rv32im(pSrcX, N, shift, pDstR);
+    } else {
+        plp_mat_herk_cmplx_q16s_xpulpv2(pSrcX, N, shift, pDstR);
+    }
+}
+
+/**
+  @} end of MatHerkCmplx group
+ */
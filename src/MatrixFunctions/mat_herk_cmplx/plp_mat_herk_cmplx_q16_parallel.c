@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_cmplx_q16_parallel.c
+ * Description:  Parallel complex Hermitian rank-1 update glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatHerkCmplx
+  @{
+ */
+
+/**
+  @brief         Glue code of parallel Hermitian rank-1 update for complex 16-bit fix-point
+  @param[in]     pSrcX Points to the input vector of length N
+  @param[in]     N     Length of vector SrcX, and height and width of matrix DstR
+  @param[in]     shift Amount to shift the result of each multiplication to the right
+  @param[in]     nPE   Number of cores to use for computation
+  @param[in,out] pDstR Points to the Hermitian matrix of shape NxN, only its upper
+                       triangle is updated
+  @return        none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is added
+  to R. Assume that vector x has `x` bits after the binary point. Then, matrix R must have
+  `2 * x - shift` bits after the binary point. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_herk_cmplx_q16_parallel(const int16_t *__restrict__ pSrcX,
+                                     uint32_t N,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_herk_cmplx_instance_q16 args = { .pSrcX = pSrcX,
+                                                 .N = N,
+                                                 .shift = shift,
+                                                 .nPE = nPE,
+                                                 .pDstR = pDstR };
+
+        rt_team_fork(nPE, plp_mat_herk_cmplx_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatHerkCmplx group
+ */
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herk_cmplx_q32.c
+ * Description:  Complex Hermitian rank-1 update glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatHerkCmplx
+  @{
+ */
+
+/**
+  @brief         Glue code of Hermitian rank-1 update for complex 32-bit fix-point
+  @param[in]     pSrcX Points to the input vector of length N
+  @param[in]     N     Length of vector SrcX, and height and width of matrix DstR
+  @param[in]     shift Amount to shift the result of each multiplication to the right
+  @param[in,out] pDstR Points to the Hermitian matrix of shape NxN, only its upper
+                       triangle is updated
+  @return        none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is added
+  to R. Assume that vector x has `x` bits after the binary point. Then, matrix R must have
+  `2 * x - shift` bits after the binary point. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_herk_cmplx_q32(const int32_t *__restrict__ pSrcX,
+                            uint32_t N,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_herk_cmplx_q32s_rv32im(pSrcX, N, shift, pDstR);
+    } else {
+        plp_mat_herk_cmplx_q32s_xpulpv2(pSrcX, N, shift, pDstR);
+    }
+}
+
+/**
+  @} end of MatHerkCmplx group
+ */
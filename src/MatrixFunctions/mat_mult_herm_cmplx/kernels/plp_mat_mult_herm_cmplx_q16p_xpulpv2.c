@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_herm_cmplx_q16p_xpulpv2.c
+ * Description:  Parallel complex Hermitian transpose matrix multiplication kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultHermCmplx
+ */
+
+/**
+  @addtogroup MatMultHermCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Parallel Hermitian transpose matrix multiplication for complex 16-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_herm_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is
+  accumulated. Assume that matrix A has `x`, and B has `y` bits after the binary point. Then,
+  the output matrix C has `x + y - shift` bits after the binary point. The output matrix is
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_mult_herm_cmplx_q16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_cmplx_instance_q16 *a = (plp_mat_mult_cmplx_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDstC = a->pDstC;
+
+    for (int m = core_id; m < M; m += nPE) {
+        for (int o = 0; o < O; o++) {
+            int32_t sum_re = 0;
+            int32_t sum_im = 0;
+            for (int n = 0; n < N; n++) {
+                int32_t a_re = pSrcA[(n * M + m) * 2 + 0];
+                int32_t a_im = pSrcA[(n * M + m) * 2 + 1];
+                int32_t b_re = pSrcB[(n * O + o) * 2 + 0];
+                int32_t b_im = pSrcB[(n * O + o) * 2 + 1];
+                sum_re += __ROUNDNORM_REG(a_re * b_re + a_im * b_im, shift);
+                sum_im += __ROUNDNORM_REG(a_re * b_im - a_im * b_re, shift);
+            }
+            pDstC[(m * O + o) * 2 + 0] = (int16_t)sum_re;
+            pDstC[(m * O + o) * 2 + 1] = (int16_t)sum_im;
+        }
+    }
+}
+
+/**
+   @} end of MatMultHermCmplxKernels group
+*/
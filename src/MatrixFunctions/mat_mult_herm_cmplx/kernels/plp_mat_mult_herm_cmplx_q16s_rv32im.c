@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_herm_cmplx_q16s_rv32im.c
+ * Description:  Complex Hermitian transpose matrix multiplication kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultHermCmplx
+ */
+
+/**
+  @defgroup MatMultHermCmplxKernels Complex Matrix Hermitian Transpose Matrix Multiplication Kernels
+  This module contains the kernels for complex Hermitian transpose matrix multiplication.
+
+  The Hermitian Transpose Matrix Multiplication computes the product of the conjugate
+  transpose of the matrix A with shape NxM and the matrix B with shape NxO. Both matrices are
+  accessed column wise, the values of the first are conjugated, multiplied with the values
+  of the second and then summed up to give the value for the result matrix.
+
+      pDst[m,o] = conj(pSrcA[0,m])*pSrcB[0,o] + ... + conj(pSrcA[N-1,m])*pSrcB[N-1,o]
+
+  This is the product `A^H * B` needed for example to form `R^H` or the sample covariance
+  `X^H * X` of a snapshot matrix, without building the conjugate transpose in memory.
+
+  These functions assume all matrices and vectors to be complex. They must be stored such that
+  real and imaginary part of any element are directly next to each other. The dimensionality
+  (`M`, `N`, `O`) still counts the number of elements in each dimension, such that a complex
+  matrix X with shape MxN has size `M * N * 2`. To access the real and imaginary part of this
+  matrix `X`, do:
+
+      Re(X[m, n]): pX[(m * N + n) * 2]
+      Im(X[m, n]): pX[(m * N + n) * 2 + 1]
+
+  There are functions for 32- and 16-bit fix-point and for 32-bit floating point data types.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_mult_herm_cmplx_q32s_xpulpv2`):
+
+      plp_<function name>_<data type><precision><method>_<isa_extension>
+
+  name          | description
+  ------------- | ---------------------------------------------------------------------------
+  function_name | `mat_mult_herm_cmplx`
+  data type     | {`f`, `q`} respectively for floats and fixed points
+  precision     | {`32`, `16`} bits
+  method        | {`s`, `p`} meaning scalar and parallel, respectively
+  isa_extension | {`rv32im`, `xpulpv2`} respectively for ibex and riscy
+ */
+
+/**
+  @addtogroup MatMultHermCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Hermitian transpose matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape NxM
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Width of matrix SrcA and height of matrix DstC
+  @param[in]  N     Height of matrix SrcA and SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication to the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is
+  accumulated. Assume that matrix A has `x`, and B has `y` bits after the binary point. Then,
+  the output matrix C has `x + y - shift` bits after the binary point. The output matrix is
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_mult_herm_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstC) {
+
+    int32_t bias = (1 << shift) >> 1; // round to nearest
+
+    for (int m = 0; m < M; m++) {
+        for (int o = 0; o < O; o++) {
+            int32_t sum_re = 0;
+            int32_t sum_im = 0;
+            for (int n = 0; n < N; n++) {
+                int32_t a_re = pSrcA[(n * M + m) * 2 + 0];
+                int32_t a_im = pSrcA[(n * M + m) * 2 + 1];
+                int32_t b_re = pSrcB[(n * O + o) * 2 + 0];
+                int32_t b_im = pSrcB[(n * O + o) * 2 + 1];
+                sum_re += (a_re * b_re + a_im * b_im + bias) >> shift;
+                sum_im += (a_re * b_im - a_im * b_re + bias) >> shift;
+            }
+            pDstC[(m * O + o) * 2 + 0] = (int16_t)sum_re;
+            pDstC[(m * O + o) * 2 + 1] = (int16_t)sum_im;
+        }
+    }
+}
+
+/**
+   @} end of MatMultHermCmplxKernels group
+*/
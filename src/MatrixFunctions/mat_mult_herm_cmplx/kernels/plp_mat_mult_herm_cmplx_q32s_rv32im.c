@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_herm_cmplx_q32s_rv32im.c
+ * Description:  Complex Hermitian transpose matrix multiplication kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultHermCmplx
+ */
+
+/**
+  @addtogroup MatMultHermCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Hermitian transpose matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape NxM
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Width of matrix SrcA and height of matrix DstC
+  @param[in]  N     Height of matrix SrcA and SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication to the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is
+  accumulated. Assume that matrix A has `x`, and B has `y` bits after the binary point. Then,
+  the output matrix C has `x + y - shift` bits after the binary point. The output matrix is
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_mult_herm_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int32_t *__restrict__ pDstC) {
+
+    int64_t bias = ((int64_t)1 << shift) >> 1; // round to nearest
+
+    for (int m = 0; m < M; m++) {
+        for (int o = 0; o < O; o++) {
+            int32_t sum_re = 0;
+            int32_t sum_im = 0;
+            for (int n = 0; n < N; n++) {
+                int32_t a_re = pSrcA[(n * M + m) * 2 + 0];
+                int32_t a_im = pSrcA[(n * M + m) * 2 + 1];
+                int32_t b_re = pSrcB[(n * O + o) * 2 + 0];
+                int32_t b_im = pSrcB[(n * O + o) * 2 + 1];
+                int64_t re = (int64_t)a_re * b_re + (int64_t)a_im * b_im;
+                int64_t im = (int64_t)a_re * b_im - (int64_t)a_im * b_re;
+                sum_re += (int32_t)((re + bias) >> shift);
+                sum_im += (int32_t)((im + bias) >> shift);
+            }
+            pDstC[(m * O + o) * 2 + 0] = (int32_t)sum_re;
+            pDstC[(m * O + o) * 2 + 1] = (int32_t)sum_im;
+        }
+    }
+}
+
+/**
+   @} end of MatMultHermCmplxKernels group
+*/
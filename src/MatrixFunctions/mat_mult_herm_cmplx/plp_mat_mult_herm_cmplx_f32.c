@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_herm_cmplx_f32.c
+ * Description:  Complex Hermitian transpose matrix multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultHermCmplx
+  @{
+ */
+
+/**
+  @brief      Glue code of Hermitian transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape NxM
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Width of matrix SrcA and height of matrix DstC
+  @param[in]  N     Height of matrix SrcA and SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_herm_cmplx_f32(const float *__restrict__ pSrcA,
+                                 const float *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_herm_cmplx_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultHermCmplx group
+ */
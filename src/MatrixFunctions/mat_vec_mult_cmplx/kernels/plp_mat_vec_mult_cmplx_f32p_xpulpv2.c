@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_f32p_xpulpv2.c
+ * Description:  Parallel complex matrix vector multiplication kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMultCmplx
+ */
+
+/**
+  @addtogroup MatVecMultCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Parallel matrix vector multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_vec_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_vec_mult_cmplx_f32_parallel
+  @return     none
+ */
+
+void plp_mat_vec_mult_cmplx_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_vec_mult_cmplx_instance_f32 *a = (plp_mat_vec_mult_cmplx_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstY = a->pDstY;
+
+    for (int m = core_id; m < M; m += nPE) {
+        float sum_re = 0.f;
+        float sum_im = 0.f;
+        for (int n = 0; n < N; n++) {
+            float a_re = pSrcA[(m * N + n) * 2 + 0];
+            float a_im = pSrcA[(m * N + n) * 2 + 1];
+            float x_re = pSrcX[n * 2 + 0];
+            float x_im = pSrcX[n * 2 + 1];
+            sum_re += a_re * x_re - a_im * x_im;
+            sum_im += a_re * x_im + a_im * x_re;
+        }
+        pDstY[m * 2 + 0] = sum_re;
+        pDstY[m * 2 + 1] = sum_im;
+    }
+}
+
+/**
+   @} end of MatVecMultCmplxKernels group
+*/
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_q16s_xpulpv2.c
+ * Description:  Complex matrix vector multiplication kernel
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMultCmplx
+ */
+
+/**
+  @addtogroup MatVecMultCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Matrix vector multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the input matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of matrix SrcA and length of vector DstY
+  @param[in]  N     Width of matrix SrcA and length of vector SrcX
+  @param[in]  shift Amount to shift the result of each multiplication to the right
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is
+  accumulated. Assume that matrix A has `x`, and vector x has `y` bits after the binary
+  point. Then, the output vector y has `x + y - shift` bits after the binary point. The
+  output is stored with the same number of bits as the inputs. Set the `shift` parameter such
+  that no overflow occurs.
+ */
+
+void plp_mat_vec_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstY) {
+
+    for (int m = 0; m < M; m++) {
+        int32_t sum_re = 0;
+        int32_t sum_im = 0;
+        for (int n = 0; n < N; n++) {
+            int32_t a_re = pSrcA[(m * N + n) * 2 + 0];
+            int32_t a_im = pSrcA[(m * N + n) * 2 + 1];
+            int32_t x_re = pSrcX[n * 2 + 0];
+            int32_t x_im = pSrcX[n * 2 + 1];
+            sum_re += __ROUNDNORM_REG(a_re * x_re - a_im * x_im, shift);
+            sum_im += __ROUNDNORM_REG(a_re * x_im + a_im * x_re, shift);
+        }
+        pDstY[m * 2 + 0] = (int16_t)sum_re;
+        pDstY[m * 2 + 1] = (int16_t)sum_im;
+    }
+}
+
+/**
+   @} end of MatVecMultCmplxKernels group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_f32_parallel.c
+ * Description:  Parallel complex matrix vector multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMultCmplx
+  @{
+ */
+
+/**
+  @brief      Glue code of parallel matrix vector multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the input matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of matrix SrcA and length of vector DstY
+  @param[in]  N     Width of matrix SrcA and length of vector SrcX
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_vec_mult_cmplx_instance_f32 args = { .pSrcA = pSrcA,
+                                                     .pSrcX = pSrcX,
+                                                     .M = M,
+                                                     .N = N,
+                                                     .nPE = nPE,
+                                                     .pDstY = pDstY };
+
+        rt_team_fork(nPE, plp_mat_vec_mult_cmplx_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatVecMultCmplx group
+ */
@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_q16.c
+ * Description:  Complex matrix vector multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatVecMultCmplx Complex Matrix Vector Multiplication
+  This module contains the glue code for complex matrix vector multiplication. The kernel codes
+  (kernels) are in the Module @ref MatVecMultCmplxKernels.
+
+  The Matrix Vector Multiplication computes the product of the matrix A with shape MxN and
+  the column vector x of length N. The matrix is accessed row wise, every row is multiplied
+  element wise with the vector and the sum of the products gives the value of the result.
+
+      pDstY[m] = pSrcA[m,0]*pSrcX[0] + pSrcA[m,1]*pSrcX[1] + ... + pSrcA[m,N-1]*pSrcX[N-1]
+
+  Quadratic forms like `a^H * R * a` are computed as `y = R * a` followed by the complex dot
+  product of `conj(a)` (see @ref cmplx_conj) and `y`.
+
+  These functions assume all matrices and vectors to be complex. They must be stored such that
+  real and imaginary part of any element are directly next to each other. The dimensionality
+  (`M`, `N`, `O`) still counts the number of elements in each dimension, such that a complex
+  matrix X with shape MxN has size `M * N * 2`. To access the real and imaginary part of this
+  matrix `X`, do:
+
+      Re(X[m, n]): pX[(m * N + n) * 2]
+      Im(X[m, n]): pX[(m * N + n) * 2 + 1]
+
+  There are functions for 32- and 16-bit fix-point and for 32-bit floating point data types.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_vec_mult_cmplx_q32`):
+
+      plp_<function name>_<data type><precision>[_parallel]
+
+  name          | description
+  ------------- | ---------------------------------------------------------
+  function_name | `mat_vec_mult_cmplx`
+  data type     | {f, q} respectively for floats and fixed points
+  precision     | {32, 16} bits
+ */
+
+/**
+  @addtogroup MatVecMultCmplx
+  @{
+ */
+
+/**
+  @brief      Glue code of matrix vector multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the input matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of matrix SrcA and length of vector DstY
+  @param[in]  N     Width of matrix SrcA and length of vector SrcX
+  @param[in]  shift Amount to shift the result of each multiplication to the right
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is
+  accumulated. Assume that matrix A has `x`, and vector x has `y` bits after the binary
+  point. Then, the output vector y has `x + y - shift` bits after the binary point. The
+  output is stored with the same number of bits as the inputs. Set the `shift` parameter such
+  that no overflow occurs.
+ */
+
+void plp_mat_vec_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t shift,
+                                int16_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_mult_cmplx_q16s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY);
+    } else {
+        plp_mat_vec_mult_cmplx_q16s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY);
+    }
+}
+
+/**
+  @} end of MatVecMultCmplx group
+ */
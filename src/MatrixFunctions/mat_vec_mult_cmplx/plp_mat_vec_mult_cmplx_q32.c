@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_cmplx_q32.c
+ * Description:  Complex matrix vector multiplication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMultCmplx
+  @{
+ */
+
+/**
+  @brief      Glue code of matrix vector multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the input matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of matrix SrcA and length of vector DstY
+  @param[in]  N     Width of matrix SrcA and length of vector SrcX
+  @param[in]  shift Amount to shift the result of each multiplication to the right
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Fix-Point
+  Every product is shifted by `shift` to the right (rounding to nearest) before it is
+  accumulated. Assume that matrix A has `x`, and vector x has `y` bits after the binary
+  point. Then, the output vector y has `x + y - shift` bits after the binary point. The
+  output is stored with the same number of bits as the inputs. Set the `shift` parameter such
+  that no overflow occurs.
+ */
+
+void plp_mat_vec_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                                const int32_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t shift,
+                                int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_mult_cmplx_q32s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY);
+    } else {
+        plp_mat_vec_mult_cmplx_q32s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY);
+    }
+}
+
+/**
+  @} end of MatVecMultCmplx group
+ */
@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmax_f32s_xpulpv2.c
+ * Description:  Max value and its index of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup argmax
+*/
+
+/**
+   @addtogroup argmaxKernels
+   @{
+*/
+
+/**
+   @brief         Max value and its index of a 32-bit floating point vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, must be at least one
+   @param[out]    pRes       max value returned here
+   @param[out]    pIndex     index of the first occurrence of the max value
+   @return        none
+*/
+
+void plp_argmax_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex) {
+
+    uint32_t blkCnt;
+    float32_t res = pSrc[0];
+    uint32_t index = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // even and odd samples are tracked in two lanes to break the dependency chain
+    float32_t res1 = pSrc[0];
+    uint32_t index1 = 0;
+    float32_t x0, x1;
+
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        x0 = pSrc[blkCnt];
+        x1 = pSrc[blkCnt + 1];
+        if (x0 > res) {
+            res = x0;
+            index = blkCnt;
+        }
+        if (x1 > res1) {
+            res1 = x1;
+            index1 = blkCnt + 1;
+        }
+    }
+
+    if (blockSize % 2 == 1) {
+        x0 = pSrc[blockSize - 1];
+        if (x0 > res) {
+            res = x0;
+            index = blockSize - 1;
+        }
+    }
+
+    if (res1 > res || (res1 == res && index1 < index)) {
+        res = res1;
+        index = index1;
+    }
+
+#else
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] > res) {
+            res = pSrc[blkCnt];
+            index = blkCnt;
+        }
+    }
+
+#endif
+
+    *pRes = res;
+    *pIndex = index;
+}
+
+/**
+  @} end of argmaxKernels group
+ */
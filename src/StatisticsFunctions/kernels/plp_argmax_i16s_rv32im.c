@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmax_i16s_rv32im.c
+ * Description:  Max value and its index of a 16-bit integer vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup argmax
+*/
+
+/**
+   @addtogroup argmaxKernels
+   @{
+*/
+
+/**
+   @brief         Max value and its index of a 16-bit integer vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, must be at least one
+   @param[out]    pRes       max value returned here
+   @param[out]    pIndex     index of the first occurrence of the max value
+   @return        none
+*/
+
+void plp_argmax_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int16_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex) {
+
+    uint32_t blkCnt;
+    int16_t res = pSrc[0];
+    uint32_t index = 0;
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] > res) {
+            res = pSrc[blkCnt];
+            index = blkCnt;
+        }
+    }
+
+    *pRes = res;
+    *pIndex = index;
+}
+
+/**
+  @} end of argmaxKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i16p_xpulpv2.c
+ * Description:  Parallel histogram of a 16-bit integer vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief         Parallel histogram of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]     task_args  pointer to plp_histogram_instance_i16 struct initialized by
+                             plp_histogram_i16_parallel
+   @return        none
+*/
+
+void plp_histogram_i16p_xpulpv2(void *task_args) {
+
+    plp_histogram_instance_i16 *S = (plp_histogram_instance_i16 *)task_args;
+
+    const int16_t *pSrc = S->pSrc;
+    uint32_t *pHist = S->pHist;
+    uint32_t *pPrivate = S->pPrivate;
+    uint32_t blockSize = S->blockSize;
+    uint32_t shift = S->shift;
+    uint32_t nPE = S->nPE;
+    uint32_t core = rt_core_id();
+    uint32_t nBins = 65536U >> shift;
+
+    // keep the blocks word aligned for the packed loads of the kernel
+    uint32_t blkSizePE = ((blockSize + nPE - 1) / nPE + 1) & ~1U;
+    uint32_t start = core * blkSizePE;
+    uint32_t len = 0;
+    uint32_t *pBins;
+    uint32_t bin, end, sum, c;
+
+    if (start < blockSize) {
+        len = (blockSize - start < blkSizePE) ? blockSize - start : blkSizePE;
+    }
+
+    pBins = (core == 0) ? pHist : pPrivate + (core - 1) * nBins;
+    plp_histogram_i16s_xpulpv2(pSrc + start, len, shift, pBins);
+
+    rt_team_barrier();
+
+    // bin-wise reduction of the private bins into pHist
+    blkSizePE = (nBins + nPE - 1) / nPE;
+    bin = core * blkSizePE;
+    end = (bin + blkSizePE < nBins) ? bin + blkSizePE : nBins;
+
+    for (; bin < end; bin++) {
+        sum = pHist[bin];
+        for (c = 0; c < nPE - 1; c++) {
+            sum += pPrivate[c * nBins + bin];
+        }
+        pHist[bin] = sum;
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of histogramKernels group
+ */
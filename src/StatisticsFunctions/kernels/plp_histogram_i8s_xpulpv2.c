@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i8s_xpulpv2.c
+ * Description:  Histogram of a 8-bit integer vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief         Histogram of a 8-bit integer vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     shift      log2 of the bin width, the histogram has 256 >> shift bins
+   @param[out]    pHist      points to the histogram, cleared before counting
+   @return        none
+*/
+
+void plp_histogram_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t shift,
+                               uint32_t *__restrict__ pHist) {
+
+    uint32_t nBins = 256U >> shift;
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    v4s x;
+    uint32_t b0, b1, b2, b3;
+    uint32_t c0, c1;
+#endif
+
+    for (blkCnt = 0; blkCnt < nBins; blkCnt++) {
+        pHist[blkCnt] = 0;
+    }
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    // both bin counts of a pair are loaded before either is stored; when the two samples fall
+    // into the same bin the second count already includes the first increment
+    for (blkCnt = 0; blkCnt < (blockSize & ~3U); blkCnt += 4) {
+        x = *((const v4s *)(pSrc + blkCnt));
+        b0 = ((uint8_t)x[0] ^ 0x80U) >> shift;
+        b1 = ((uint8_t)x[1] ^ 0x80U) >> shift;
+        b2 = ((uint8_t)x[2] ^ 0x80U) >> shift;
+        b3 = ((uint8_t)x[3] ^ 0x80U) >> shift;
+
+        c0 = pHist[b0];
+        c1 = pHist[b1];
+        c0 += 1;
+        c1 += 1 + (b0 == b1);
+        pHist[b0] = c0;
+        pHist[b1] = c1;
+
+        c0 = pHist[b2];
+        c1 = pHist[b3];
+        c0 += 1;
+        c1 += 1 + (b2 == b3);
+        pHist[b2] = c0;
+        pHist[b3] = c1;
+    }
+
+    for (; blkCnt < blockSize; blkCnt++) {
+        pHist[((uint8_t)pSrc[blkCnt] ^ 0x80U) >> shift]++;
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pHist[((uint8_t)pSrc[blkCnt] ^ 0x80U) >> shift]++;
+    }
+
+#endif
+}
+
+/**
+  @} end of histogramKernels group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_u8s_rv32im.c
+ * Description:  Histogram of a 8-bit unsigned integer vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @defgroup histogramKernels Histogram Kernels
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief         Histogram of a 8-bit unsigned integer vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     shift      log2 of the bin width, the histogram has 256 >> shift bins
+   @param[out]    pHist      points to the histogram, cleared before counting
+   @return        none
+*/
+
+void plp_histogram_u8s_rv32im(const uint8_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t shift,
+                              uint32_t *__restrict__ pHist) {
+
+    uint32_t blkCnt;
+    uint32_t nBins = 256U >> shift;
+
+    for (blkCnt = 0; blkCnt < nBins; blkCnt++) {
+        pHist[blkCnt] = 0;
+    }
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        pHist[pSrc[blkCnt] >> shift]++;
+    }
+}
+
+/**
+  @} end of histogramKernels group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_i16p_xpulpv2.c
+ * Description:  Parallel max value of a 16-bit integer vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup max
+*/
+
+/**
+   @addtogroup maxKernels
+   @{
+*/
+
+/**
+   @brief         Parallel max value of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]     task_args  pointer to plp_stats_instance_i16 struct initialized by
+                             plp_max_i16_parallel
+   @return        none
+*/
+
+void plp_max_i16p_xpulpv2(void *task_args) {
+
+    plp_stats_instance_i16 *S = (plp_stats_instance_i16 *)task_args;
+
+    uint32_t blkSizePE = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start, len;
+
+    // keep the blocks word aligned for the SIMD loads
+    blkSizePE = (blkSizePE + 1) & ~1U;
+
+    start = rt_core_id() * blkSizePE;
+    len = 0;
+    if (start < S->blockSize) {
+        len = (S->blockSize - start < blkSizePE) ? S->blockSize - start : blkSizePE;
+    }
+
+    // cores without samples contribute the first sample, which does not change the result
+    const int16_t *pSrc = (len > 0) ? S->pSrc + start : S->pSrc;
+    int16_t res = pSrc[0];
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    v2s vRes = { res, res };
+
+    for (blkCnt = 0; blkCnt < (len & ~1U); blkCnt += 2) {
+        vRes = __MAX2(vRes, *((v2s *)(pSrc + blkCnt)));
+    }
+    res = __MAX(vRes[0], vRes[1]);
+
+    for (; blkCnt < len; blkCnt++) {
+        if (pSrc[blkCnt] > res) {
+            res = pSrc[blkCnt];
+        }
+    }
+
+#else
+
+    for (blkCnt = 1; blkCnt < len; blkCnt++) {
+        if (pSrc[blkCnt] > res) {
+            res = pSrc[blkCnt];
+        }
+    }
+
+#endif
+
+    S->pPartial[rt_core_id()] = res;
+
+    plp_reduce_i32p_xpulpv2(S->pPartial, S->nPE, PLP_REDUCE_MAX);
+}
+
+/**
+  @} end of maxKernels group
+ */
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_i32p_xpulpv2.c
+ * Description:  Parallel mean value of a 32-bit integer vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup mean
+*/
+
+/**
+   @addtogroup meanKernels
+   @{
+*/
+
+/**
+   @brief         Parallel mean value of a 32-bit integer vector for XPULPV2 extension.
+   @param[in]     task_args  pointer to plp_stats_instance_i32 struct initialized by
+                             plp_mean_i32_parallel
+   @return        none
+*/
+
+void plp_mean_i32p_xpulpv2(void *task_args) {
+
+    plp_stats_instance_i32 *S = (plp_stats_instance_i32 *)task_args;
+
+    uint32_t blkSizePE = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start, len;
+
+    start = rt_core_id() * blkSizePE;
+    len = 0;
+    if (start < S->blockSize) {
+        len = (S->blockSize - start < blkSizePE) ? S->blockSize - start : blkSizePE;
+    }
+
+    const int32_t *pSrc = S->pSrc + start;
+    int32_t sum = 0;
+    uint32_t blkCnt;
+
+    for (blkCnt = 0; blkCnt < len; blkCnt++) {
+        sum += pSrc[blkCnt];
+    }
+
+    S->pPartial[rt_core_id()] = sum;
+
+    plp_reduce_i32p_xpulpv2(S->pPartial, S->nPE, PLP_REDUCE_SUM);
+}
+
+/**
+  @} end of meanKernels group
+ */
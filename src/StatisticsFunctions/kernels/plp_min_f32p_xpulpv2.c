@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_min_f32p_xpulpv2.c
+ * Description:  Parallel min value of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup min
+*/
+
+/**
+   @addtogroup minKernels
+   @{
+*/
+
+/**
+   @brief         Parallel min value of a 32-bit floating point vector for XPULPV2 extension.
+   @param[in]     task_args  pointer to plp_stats_instance_f32 struct initialized by
+                             plp_min_f32_parallel
+   @return        none
+*/
+
+void plp_min_f32p_xpulpv2(void *task_args) {
+
+    plp_stats_instance_f32 *S = (plp_stats_instance_f32 *)task_args;
+
+    uint32_t blkSizePE = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start, len;
+
+    start = rt_core_id() * blkSizePE;
+    len = 0;
+    if (start < S->blockSize) {
+        len = (S->blockSize - start < blkSizePE) ? S->blockSize - start : blkSizePE;
+    }
+
+    // cores without samples contribute the first sample, which does not change the result
+    const float32_t *pSrc = (len > 0) ? S->pSrc + start : S->pSrc;
+    float32_t res = pSrc[0];
+    uint32_t blkCnt;
+
+    for (blkCnt = 1; blkCnt < len; blkCnt++) {
+        if (pSrc[blkCnt] < res) {
+            res = pSrc[blkCnt];
+        }
+    }
+
+    S->pPartial[rt_core_id()] = res;
+
+    plp_reduce_f32p_xpulpv2(S->pPartial, S->nPE, PLP_REDUCE_MIN);
+}
+
+/**
+  @} end of minKernels group
+ */
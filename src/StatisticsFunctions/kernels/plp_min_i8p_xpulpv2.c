@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_min_i8p_xpulpv2.c
+ * Description:  Parallel min value of a 8-bit integer vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup min
+*/
+
+/**
+   @addtogroup minKernels
+   @{
+*/
+
+/**
+   @brief         Parallel min value of a 8-bit integer vector for XPULPV2 extension.
+   @param[in]     task_args  pointer to plp_stats_instance_i8 struct initialized by
+                             plp_min_i8_parallel
+   @return        none
+*/
+
+void plp_min_i8p_xpulpv2(void *task_args) {
+
+    plp_stats_instance_i8 *S = (plp_stats_instance_i8 *)task_args;
+
+    uint32_t blkSizePE = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start, len;
+
+    // keep the blocks word aligned for the SIMD loads
+    blkSizePE = (blkSizePE + 3) & ~3U;
+
+    start = rt_core_id() * blkSizePE;
+    len = 0;
+    if (start < S->blockSize) {
+        len = (S->blockSize - start < blkSizePE) ? S->blockSize - start : blkSizePE;
+    }
+
+    // cores without samples contribute the first sample, which does not change the result
+    const int8_t *pSrc = (len > 0) ? S->pSrc + start : S->pSrc;
+    int8_t res = pSrc[0];
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    v4s vRes = { res, res, res, res };
+
+    for (blkCnt = 0; blkCnt < (len & ~3U); blkCnt += 4) {
+        vRes = __MIN4(vRes, *((v4s *)(pSrc + blkCnt)));
+    }
+    res = __MIN(__MIN(vRes[0], vRes[1]), __MIN(vRes[2], vRes[3]));
+
+    for (; blkCnt < len; blkCnt++) {
+        if (pSrc[blkCnt] < res) {
+            res = pSrc[blkCnt];
+        }
+    }
+
+#else
+
+    for (blkCnt = 1; blkCnt < len; blkCnt++) {
+        if (pSrc[blkCnt] < res) {
+            res = pSrc[blkCnt];
+        }
+    }
+
+#endif
+
+    S->pPartial[rt_core_id()] = res;
+
+    plp_reduce_i32p_xpulpv2(S->pPartial, S->nPE, PLP_REDUCE_MIN);
+}
+
+/**
+  @} end of minKernels group
+ */
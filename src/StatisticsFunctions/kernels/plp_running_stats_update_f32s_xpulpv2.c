@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_update_f32s_xpulpv2.c
+ * Description:  Update of the 32-bit float running statistics for XPULPV2 extension
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup runningStats
+*/
+
+/**
+   @addtogroup runningStatsKernels
+   @{
+*/
+
+/**
+   @brief         Update of the 32-bit float running statistics for XPULPV2 extension.
+   @param[in,out] S          points to an instance of the running statistics structure
+   @param[in]     pSrc       points to the block of new samples
+   @param[in]     blockSize  number of new samples
+   @return        none
+*/
+
+void plp_running_stats_update_f32s_xpulpv2(plp_running_stats_instance_f32 *S,
+                                           const float32_t *__restrict__ pSrc,
+                                           uint32_t blockSize) {
+
+    plp_running_stats_instance_f32 blk;
+    float32_t shift, d, m;
+    float32_t s1 = 0.0f;
+    float32_t s2 = 0.0f;
+    uint32_t blkCnt;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    // accumulate around the current mean (or the first sample), which avoids the cancellation of
+    // the plain sum of squares for signals with a large offset
+    shift = (S->count > 0) ? S->mean : pSrc[0];
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    float32_t d1, s1b = 0.0f, s2b = 0.0f;
+
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        d = pSrc[blkCnt] - shift;
+        d1 = pSrc[blkCnt + 1] - shift;
+        s1 += d;
+        s2 += d * d;
+        s1b += d1;
+        s2b += d1 * d1;
+    }
+
+    if (blockSize % 2 == 1) {
+        d = pSrc[blkCnt] - shift;
+        s1 += d;
+        s2 += d * d;
+    }
+
+    s1 += s1b;
+    s2 += s2b;
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        d = pSrc[blkCnt] - shift;
+        s1 += d;
+        s2 += d * d;
+    }
+
+#endif
+
+    m = s1 / blockSize;
+
+    blk.count = blockSize;
+    blk.mean = shift + m;
+    blk.m2 = s2 - s1 * m;
+
+    plp_running_stats_merge_f32(S, &blk);
+}
+
+/**
+  @} end of runningStatsKernels group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_update_q16p_xpulpv2.c
+ * Description:  Parallel update of the 16-bit fixed point running statistics for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup runningStats
+*/
+
+/**
+   @addtogroup runningStatsKernels
+   @{
+*/
+
+/**
+   @brief         Parallel update of the 16-bit fixed point running statistics for XPULPV2
+                  extension.
+   @param[in]     task_args  pointer to plp_running_stats_instance_q16_parallel struct
+                             initialized by plp_running_stats_update_q16_parallel
+   @return        none
+*/
+
+void plp_running_stats_update_q16p_xpulpv2(void *task_args) {
+
+    plp_running_stats_instance_q16_parallel *P = task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t blkSizePE = (P->blockSize + P->nPE - 1) / P->nPE;
+    uint32_t start, len, i;
+
+    // keep the blocks word aligned for the SIMD loads
+    blkSizePE = (blkSizePE + 1) & ~1U;
+
+    start = core_id * blkSizePE;
+    len = 0;
+    if (start < P->blockSize) {
+        len = (P->blockSize - start < blkSizePE) ? P->blockSize - start : blkSizePE;
+    }
+
+    plp_running_stats_init_q16(&P->pPartial[core_id], P->S->fracBits);
+    plp_running_stats_update_q16s_xpulpv2(&P->pPartial[core_id], P->pSrc + start, len);
+
+    rt_team_barrier();
+
+    if (core_id == 0) {
+        for (i = 0; i < P->nPE; i++) {
+            plp_running_stats_merge_q16(P->S, &P->pPartial[i]);
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of runningStatsKernels group
+ */
@@ -0,0 +1,121 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_update_q16s_xpulpv2.c
+ * Description:  Update of the 16-bit fixed point running statistics for XPULPV2 extension
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup runningStats
+*/
+
+/**
+   @addtogroup runningStatsKernels
+   @{
+*/
+
+/**
+   @brief         Update of the 16-bit fixed point running statistics for XPULPV2 extension.
+   @param[in,out] S          points to an instance of the running statistics structure
+   @param[in]     pSrc       points to the block of new samples
+   @param[in]     blockSize  number of new samples
+   @return        none
+*/
+
+void plp_running_stats_update_q16s_xpulpv2(plp_running_stats_instance_q16 *S,
+                                           const int16_t *__restrict__ pSrc,
+                                           uint32_t blockSize) {
+
+    plp_running_stats_instance_q16 blk;
+    int32_t shift, d, m, rem;
+    int32_t s1 = 0;
+    int64_t s2 = 0;
+    uint32_t blkCnt;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    // accumulate around the current mean (or the first sample), so the deviations stay small
+    shift = (S->count > 0) ? S->mean : pSrc[0];
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    int32_t d1;
+    v2s x;
+
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        x = *((v2s *)(pSrc + blkCnt));
+        d = x[0] - shift;
+        d1 = x[1] - shift;
+        s1 += d + d1;
+        s2 += (int64_t)d * d + (int64_t)d1 * d1;
+    }
+
+    if (blockSize % 2 == 1) {
+        d = pSrc[blkCnt] - shift;
+        s1 += d;
+        s2 += (int64_t)d * d;
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        d = pSrc[blkCnt] - shift;
+        s1 += d;
+        s2 += (int64_t)d * d;
+    }
+
+#endif
+
+    // block mean rounded to the nearest value, the remainder is passed on to the merge
+    m = s1 / (int32_t)blockSize;
+    rem = s1 - m * (int32_t)blockSize;
+    if (2 * rem >= (int32_t)blockSize) {
+        m++;
+        rem -= (int32_t)blockSize;
+    } else if (2 * rem <= -(int32_t)blockSize) {
+        m--;
+        rem += (int32_t)blockSize;
+    }
+
+    // deviations from the exact block mean: sum (d - m)^2 - rem^2 / n
+    //                                      = s2 - 2 m s1 + n m^2 - rem^2 / n
+    blk.m2 = (s2 - 2 * (int64_t)m * s1 + (int64_t)blockSize * m * m -
+              (int64_t)rem * rem / blockSize) >>
+             S->fracBits;
+
+    blk.count = blockSize;
+    blk.fracBits = S->fracBits;
+    blk.mean = shift + m;
+    blk.meanRem = rem;
+
+    plp_running_stats_merge_q16(S, &blk);
+}
+
+/**
+  @} end of runningStatsKernels group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_update_q32s_rv32im.c
+ * Description:  Update of the 32-bit fixed point running statistics for RV32IM extension
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @brief Absolute difference of two 32-bit values.
+  @param[in]  x     sample
+  @param[in]  mean  mean
+  @return     |x - mean|, which needs up to 32 bits
+ */
+
+static inline uint64_t plp_running_stats_absdiff_q32(int32_t x, int32_t mean) {
+    return (x > mean) ? (uint64_t)((int64_t)x - mean) : (uint64_t)((int64_t)mean - x);
+}
+
+/**
+   @ingroup runningStats
+*/
+
+/**
+   @addtogroup runningStatsKernels
+   @{
+*/
+
+/**
+   @brief         Update of the 32-bit fixed point running statistics for RV32IM extension.
+   @param[in,out] S          points to an instance of the running statistics structure
+   @param[in]     pSrc       points to the block of new samples
+   @param[in]     blockSize  number of new samples
+   @return        none
+*/
+
+void plp_running_stats_update_q32s_rv32im(plp_running_stats_instance_q32 *S,
+                                          const int32_t *__restrict__ pSrc,
+                                          uint32_t blockSize) {
+
+    plp_running_stats_instance_q32 blk;
+    const uint32_t fracBits = S->fracBits;
+    int64_t s1 = 0, rem;
+    uint64_t d;
+    uint32_t blkCnt;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    // first pass: mean of the block
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        s1 += pSrc[blkCnt];
+    }
+
+    // block mean rounded to the nearest value, the remainder is passed on to the merge
+    blk.count = blockSize;
+    blk.fracBits = fracBits;
+    blk.mean = (int32_t)(s1 / (int32_t)blockSize);
+    rem = s1 - (int64_t)blk.mean * (int32_t)blockSize;
+    if (2 * rem >= (int32_t)blockSize) {
+        blk.mean++;
+        rem -= (int32_t)blockSize;
+    } else if (2 * rem <= -(int32_t)blockSize) {
+        blk.mean--;
+        rem += (int32_t)blockSize;
+    }
+    blk.meanRem = (int32_t)rem;
+    blk.m2 = 0;
+
+    // second pass: squared deviations from the block mean. They are formed as unsigned 64-bit
+    // values, since a deviation of full scale q32 samples needs 32 bits plus the sign. Using the
+    // rounded mean adds rem^2 / n <= n / 4 before the shift, less than the per sample shifts drop.
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        d = plp_running_stats_absdiff_q32(pSrc[blkCnt], blk.mean);
+        blk.m2 += (int64_t)((d * d) >> fracBits);
+    }
+
+    plp_running_stats_merge_q32(S, &blk);
+}
+
+/**
+  @} end of runningStatsKernels group
+ */
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_i8s_rv32im.c
+ * Description:  Single pass statistics of a 8-bit integer vector for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @defgroup statsKernels Stats Kernels
+*/
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/**
+   @brief         Single pass statistics of a 8-bit integer vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, must be at least one
+   @param[out]    pRes       statistics returned here
+   @return        none
+*/
+
+void plp_stats_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          plp_stats_result_i32 *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    int8_t x;
+    int8_t min = pSrc[0];
+    int8_t max = pSrc[0];
+    uint32_t minIdx = 0;
+    uint32_t maxIdx = 0;
+    int32_t sum = 0;
+    int64_t sumSq = 0;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = pSrc[blkCnt];
+        sum += x;
+        sumSq += x * x;
+        if (x < min) {
+            min = x;
+            minIdx = blkCnt;
+        }
+        if (x > max) {
+            max = x;
+            maxIdx = blkCnt;
+        }
+    }
+
+    pRes->sum = sum;
+    pRes->sumSq = sumSq;
+    pRes->min = min;
+    pRes->max = max;
+    pRes->minIdx = minIdx;
+    pRes->maxIdx = maxIdx;
+    pRes->blockSize = blockSize;
+}
+
+/**
+  @} end of statsKernels group
+ */
@@ -0,0 +1,131 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_i8s_xpulpv2.c
+ * Description:  Single pass statistics of a 8-bit integer vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/**
+   @brief         Single pass statistics of a 8-bit integer vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, must be at least one
+   @param[out]    pRes       statistics returned here
+   @return        none
+   @par SIMD
+        The sum and the sum of squares of 4 samples are computed with one dot product
+   each, minimum and maximum are updated per lane.
+*/
+
+void plp_stats_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           plp_stats_result_i32 *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    int8_t x;
+    int8_t min = pSrc[0];
+    int8_t max = pSrc[0];
+    uint32_t minIdx = 0;
+    uint32_t maxIdx = 0;
+    int32_t sum = 0;
+    int64_t sumSq = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    const v4s ones = { 1, 1, 1, 1 };
+    v4s xv;
+    uint32_t k;
+
+    for (blkCnt = 0; blkCnt < (blockSize & ~3U); blkCnt += 4) {
+        xv = *((v4s *)(pSrc + blkCnt));
+        sum = __SUMDOTP4(xv, ones, sum);
+        sumSq += __DOTP4(xv, xv);
+
+        for (k = 0; k < 4; k++) {
+            x = xv[k];
+            if (x < min) {
+                min = x;
+                minIdx = blkCnt + k;
+            }
+            if (x > max) {
+                max = x;
+                maxIdx = blkCnt + k;
+            }
+        }
+    }
+
+    for (; blkCnt < blockSize; blkCnt++) {
+        x = pSrc[blkCnt];
+        sum += x;
+        sumSq += x * x;
+        if (x < min) {
+            min = x;
+            minIdx = blkCnt;
+        }
+        if (x > max) {
+            max = x;
+            maxIdx = blkCnt;
+        }
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = pSrc[blkCnt];
+        sum += x;
+        sumSq += x * x;
+        if (x < min) {
+            min = x;
+            minIdx = blkCnt;
+        }
+        if (x > max) {
+            max = x;
+            maxIdx = blkCnt;
+        }
+    }
+
+#endif
+
+    pRes->sum = sum;
+    pRes->sumSq = sumSq;
+    pRes->min = min;
+    pRes->max = max;
+    pRes->minIdx = minIdx;
+    pRes->maxIdx = maxIdx;
+    pRes->blockSize = blockSize;
+}
+
+/**
+  @} end of statsKernels group
+ */
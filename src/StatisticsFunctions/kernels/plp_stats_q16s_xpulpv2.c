@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_q16s_xpulpv2.c
+ * Description:  Single pass statistics of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @addtogroup statsKernels
+   @{
+*/
+
+/**
+   @brief         Single pass statistics of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, must be at least one
+   @param[in]     fracBits   number of fractional bits of the input
+   @param[out]    pRes       statistics returned here
+   @return        none
+   @par SIMD
+        The sum and the sum of squares of 2 samples are computed with one dot product
+   each, minimum and maximum are updated per lane.
+*/
+
+void plp_stats_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            plp_stats_result_i32 *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    int16_t x;
+    int16_t min = pSrc[0];
+    int16_t max = pSrc[0];
+    uint32_t minIdx = 0;
+    uint32_t maxIdx = 0;
+    int32_t sum = 0;
+    int64_t sumSq = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    const v2s ones = { 1, 1 };
+    v2s xv;
+    uint32_t k;
+
+    for (blkCnt = 0; blkCnt < (blockSize & ~1U); blkCnt += 2) {
+        xv = *((v2s *)(pSrc + blkCnt));
+        sum = __SUMDOTP2(xv, ones, sum);
+        sumSq += (uint32_t)__DOTP2(xv, xv); // up to 2^31, only fits unsigned
+
+        for (k = 0; k < 2; k++) {
+            x = xv[k];
+            if (x < min) {
+                min = x;
+                minIdx = blkCnt + k;
+            }
+            if (x > max) {
+                max = x;
+                maxIdx = blkCnt + k;
+            }
+        }
+    }
+
+    for (; blkCnt < blockSize; blkCnt++) {
+        x = pSrc[blkCnt];
+        sum += x;
+        sumSq += x * x;
+        if (x < min) {
+            min = x;
+            minIdx = blkCnt;
+        }
+        if (x > max) {
+            max = x;
+            maxIdx = blkCnt;
+        }
+    }
+
+#else
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = pSrc[blkCnt];
+        sum += x;
+        sumSq += x * x;
+        if (x < min) {
+            min = x;
+            minIdx = blkCnt;
+        }
+        if (x > max) {
+            max = x;
+            maxIdx = blkCnt;
+        }
+    }
+
+#endif
+
+    pRes->sum = sum;
+    pRes->sumSq = sumSq >> fracBits;
+    pRes->min = min;
+    pRes->max = max;
+    pRes->minIdx = minIdx;
+    pRes->maxIdx = maxIdx;
+    pRes->blockSize = blockSize;
+}
+
+/**
+  @} end of statsKernels group
+ */
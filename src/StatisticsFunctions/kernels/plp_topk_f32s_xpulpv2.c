@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_f32s_xpulpv2.c
+ * Description:  Top-k selection of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup topk
+*/
+
+/**
+   @addtogroup topkKernels
+   @{
+*/
+
+/**
+   @brief         Inserts a sample into the descending list of the top n values.
+   @param[in,out] val    points to the list of values, the last entry is overwritten
+   @param[in,out] idx    points to the list of indices
+   @param[in]     n      length of the list
+   @param[in]     x      new sample, larger than val[n - 1] if the list is full
+   @param[in]     index  index of the new sample
+   @return        smallest value of the list after the insertion
+*/
+static inline float32_t plp_topk_insert_f32(float32_t *val, uint32_t *idx, uint32_t n, float32_t x,
+                                            uint32_t index) {
+    uint32_t j;
+
+    for (j = n - 1; j > 0 && val[j - 1] < x; j--) {
+        val[j] = val[j - 1];
+        idx[j] = idx[j - 1];
+    }
+    val[j] = x;
+    idx[j] = index;
+
+    return val[n - 1];
+}
+
+/**
+   @brief         Top-k selection of a 32-bit floating point vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, at least k
+   @param[in]     k          number of samples to select, 1 <= k <= PLP_TOPK_MAX
+   @param[out]    pVal       k largest values returned here in descending order
+   @param[out]    pIdx       their indices returned here
+   @return        none
+*/
+
+void plp_topk_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t k,
+                           float32_t *__restrict__ pVal,
+                           uint32_t *__restrict__ pIdx) {
+
+    float32_t val[PLP_TOPK_MAX];
+    uint32_t idx[PLP_TOPK_MAX];
+    uint32_t blkCnt, j;
+    float32_t x, thr;
+
+    // sort the first k samples
+    for (blkCnt = 0; blkCnt < k; blkCnt++) {
+        plp_topk_insert_f32(val, idx, blkCnt + 1, pSrc[blkCnt], blkCnt);
+    }
+    thr = val[k - 1];
+
+    for (blkCnt = k; blkCnt < blockSize; blkCnt++) {
+        x = pSrc[blkCnt];
+        // only samples larger than the k-th largest so far enter the list
+        if (x > thr) {
+            thr = plp_topk_insert_f32(val, idx, k, x, blkCnt);
+        }
+    }
+
+    for (j = 0; j < k; j++) {
+        pVal[j] = val[j];
+        pIdx[j] = idx[j];
+    }
+}
+
+/**
+  @} end of topkKernels group
+ */
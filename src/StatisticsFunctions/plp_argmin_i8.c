@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmin_i8.c
+ * Description:  Min value and its index of a 8-bit integer vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup argmin Argmin
+   Min value of a vector together with the index of its first occurrence, computed in a single
+   pass. For 8- and 16-bit vectors the XPULPV2 kernels search blocks of samples with packed
+   __MIN4 / __MIN2 and only rescan the block that contains the minimum for its index.
+*/
+
+/**
+   @addtogroup argmin
+   @{
+*/
+
+/**
+   @brief         Glue code for min value and its index of a 8-bit integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, must be at least one
+   @param[out]    pRes       min value returned here
+   @param[out]    pIndex     index of the first occurrence of the min value
+   @return        none
+*/
+
+void plp_argmin_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int8_t *__restrict__ pRes,
+                   uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_argmin_i8s_rv32im(pSrc, blockSize, pRes, pIndex);
+    } else {
+        plp_argmin_i8s_xpulpv2(pSrc, blockSize, pRes, pIndex);
+    }
+}
+
+/**
+  @} end of argmin group
+ */
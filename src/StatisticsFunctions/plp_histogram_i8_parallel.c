@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i8_parallel.c
+ * Description:  Parallel histogram of a 8-bit integer vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup histogram
+   @{
+*/
+
+/**
+   @brief         Glue code for the parallel histogram of a 8-bit integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     shift      log2 of the bin width, the histogram has 256 >> shift bins
+   @param[in]     nPE        number of parallel processing units
+   @param[out]    pHist      points to the histogram, cleared before counting
+   @return        none
+   @par Parallelization
+        Every core counts a contiguous part of the vector into its own bins. Core 0 counts
+   directly into pHist, the other cores into a private buffer allocated in L1. The bins are then
+   summed up into pHist, each core taking care of a contiguous range of bins.
+   The private bins take 4 * (nPE - 1) * (256 >> shift) bytes of L1; if they do not fit, an error
+   is printed and pHist is left untouched.
+*/
+
+void plp_histogram_i8_parallel(const int8_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               uint32_t *__restrict__ pHist) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t nBins = 256U >> shift;
+        uint32_t *pPrivate = NULL;
+
+        if (nPE > 1) {
+            pPrivate = (uint32_t *)rt_alloc(RT_ALLOC_CL_DATA, sizeof(uint32_t) * nBins * (nPE - 1));
+            if (pPrivate == NULL) {
+                printf("Error: insufficient L1 memory!\n");
+                return;
+            }
+        }
+
+        plp_histogram_instance_i8 S = { .pSrc = pSrc,
+                                   .blockSize = blockSize,
+                                   .shift = shift,
+                                   .nPE = nPE,
+                                   .pHist = pHist,
+                                   .pPrivate = pPrivate };
+
+        rt_team_fork(nPE, plp_histogram_i8p_xpulpv2, (void *)&S);
+
+        if (nPE > 1) {
+            rt_free(RT_ALLOC_CL_DATA, pPrivate, sizeof(uint32_t) * nBins * (nPE - 1));
+        }
+    }
+}
+
+/**
+  @} end of histogram group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_u8.c
+ * Description:  Histogram of a 8-bit unsigned integer vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup histogram Histogram
+   Histogram of an integer vector. The bin of a sample is its value, offset to be non-negative for
+   signed types, shifted right by shift, i.e. the bins are 1 << shift wide and cover the full
+   range of the type. The XPULPV2 kernels count two samples at a time: both bin counts are loaded
+   before either is stored, and the second one is corrected when both samples fall into the same
+   bin, which hides the load-use latency of the read-modify-write. The parallel versions count
+   into per-core private bins and sum them up bin-wise on all cores.
+*/
+
+/**
+   @addtogroup histogram
+   @{
+*/
+
+/**
+   @brief         Glue code for the histogram of a 8-bit unsigned integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     shift      log2 of the bin width, the histogram has 256 >> shift bins
+   @param[out]    pHist      points to the histogram, cleared before counting
+   @return        none
+*/
+
+void plp_histogram_u8(const uint8_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t shift,
+                      uint32_t *__restrict__ pHist) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_histogram_u8s_rv32im(pSrc, blockSize, shift, pHist);
+    } else {
+        plp_histogram_u8s_xpulpv2(pSrc, blockSize, shift, pHist);
+    }
+}
+
+/**
+  @} end of histogram group
+ */
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_f32_parallel.c
+ * Description:  Parallel max value of a 32-bit floating point vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup max
+   @{
+*/
+
+/**
+   @brief         Glue code for parallel max value of a 32-bit floating point vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     nPE        number of parallel processing units
+   @param[out]    pRes       max value returned here
+   @return        none
+   @par Parallelization
+        Every core searches a contiguous block of the input, the partial results are combined with
+   plp_reduce_f32p_xpulpv2.
+*/
+
+void plp_max_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        float32_t partial[nPE];
+        plp_stats_instance_f32 S = { .pSrc = pSrc,
+                                     .blockSize = blockSize,
+                                     .nPE = nPE,
+                                     .pPartial = partial };
+
+        rt_team_fork(nPE, plp_max_f32p_xpulpv2, (void *)&S);
+
+        *pRes = partial[0];
+    }
+}
+
+/**
+  @} end of max group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_i8.c
+ * Description:  Percentile of a 8-bit integer vector from its histogram
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup percentile
+   @{
+*/
+
+/**
+   @brief         Percentile of a 8-bit integer vector estimated from its histogram.
+   @param[in]     pHist      points to a non-empty histogram computed by plp_histogram_i8
+   @param[in]     shift      log2 of the bin width the histogram was computed with
+   @param[in]     percent    percentile to estimate, 0 .. 100 (50 gives the median)
+   @param[out]    pRes       center of the bin that contains the percentile returned here
+   @return        none
+*/
+
+void plp_percentile_i8(const uint32_t *__restrict__ pHist,
+                       uint32_t shift,
+                       uint32_t percent,
+                       int8_t *__restrict__ pRes) {
+
+    uint32_t nBins = 256U >> shift;
+    uint32_t total = 0;
+    uint32_t count = 0;
+    uint32_t rank, bin;
+
+    for (bin = 0; bin < nBins; bin++) {
+        total += pHist[bin];
+    }
+
+    // nearest rank: the first bin in which the cumulative count reaches ceil(percent * total / 100)
+    rank = (uint32_t)(((uint64_t)percent * total + 99) / 100);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    for (bin = 0; bin < nBins - 1; bin++) {
+        count += pHist[bin];
+        if (count >= rank) {
+            break;
+        }
+    }
+
+    *pRes = (int8_t)((int32_t)((bin << shift) + ((1U << shift) >> 1)) - 128);
+}
+
+/**
+  @} end of percentile group
+ */
@@ -0,0 +1,55 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_init_f32.c
+ * Description:  Initialization of the 32-bit float running statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief         Initialization of the 32-bit float running statistics.
+   @param[out]    S          points to an instance of the running statistics structure
+   @return        none
+*/
+
+void plp_running_stats_init_f32(plp_running_stats_instance_f32 *S) {
+
+    S->count = 0;
+    S->mean = 0.0f;
+    S->m2 = 0.0f;
+}
+
+/**
+  @} end of runningStats group
+ */
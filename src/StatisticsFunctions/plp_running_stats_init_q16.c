@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point running statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup runningStats Running Statistics
+   Streaming mean and variance. The instance holds the number of samples, their mean and the sum
+   of squared deviations from the mean (m2). A block of new samples is accumulated around the
+   current mean, which avoids the cancellation of E[x^2] - E[x]^2 for signals with a large
+   offset, and is then combined with the instance with the pairwise update of Chan et al.:
+   <pre>
+   delta = meanB - meanA
+   mean  = meanA + delta * nB / (nA + nB)
+   m2    = m2A + m2B + delta^2 * nA * nB / (nA + nB)
+   </pre>
+   The same merge combines statistics gathered independently (e.g. per core or per chunk of a
+   long stream), so long streams can be processed in L1 sized blocks without a second pass.
+
+   For fixed point data the mean keeps the format of the samples and m2 is a 64-bit value
+   normalized by fracBits, so it does not overflow for long streams. The mean is rounded to the
+   nearest value and the remainder of the division by the number of samples is carried along in
+   meanRem, so the mean does not drift away when a long stream is merged in small blocks. The q32 update takes a second
+   pass over the block for the deviations from the block mean, and squares them as unsigned 64-bit
+   values, since full scale q32 deviations need 33 bits.
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief         Initialization of the 16-bit fixed point running statistics.
+   @param[out]    S          points to an instance of the running statistics structure
+   @param[in]     fracBits   number of fractional bits of the samples
+   @return        none
+*/
+
+void plp_running_stats_init_q16(plp_running_stats_instance_q16 *S,
+                                uint32_t fracBits) {
+
+    S->count = 0;
+    S->fracBits = fracBits;
+    S->mean = 0;
+    S->meanRem = 0;
+    S->m2 = 0;
+}
+
+/**
+  @} end of runningStats group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_merge_f32.c
+ * Description:  Merges two 32-bit float running statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief         Merges two 32-bit float running statistics.
+   @param[in,out] S          points to the running statistics to merge into
+   @param[in]     pOther     points to the running statistics of other samples
+   @return        none
+*/
+
+void plp_running_stats_merge_f32(plp_running_stats_instance_f32 *S,
+                                 const plp_running_stats_instance_f32 *pOther) {
+
+    uint32_t na = S->count;
+    uint32_t nb = pOther->count;
+    float32_t n, delta;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    }
+
+    if (nb == 0) {
+        return;
+    }
+    if (na == 0) {
+        *S = *pOther;
+        return;
+    }
+
+    n = (float32_t)na + nb;
+    delta = pOther->mean - S->mean;
+
+    S->mean += delta * (nb / n);
+    S->m2 += pOther->m2 + delta * delta * (na * (nb / n));
+    S->count = na + nb;
+}
+
+/**
+  @} end of runningStats group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_merge_q16.c
+ * Description:  Merges two 16-bit fixed point running statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief         Merges two 16-bit fixed point running statistics.
+   @param[in,out] S          points to the running statistics to merge into
+   @param[in]     pOther     points to the running statistics of other samples
+   @return        none
+*/
+
+void plp_running_stats_merge_q16(plp_running_stats_instance_q16 *S,
+                                 const plp_running_stats_instance_q16 *pOther) {
+
+    uint32_t na = S->count;
+    uint32_t nb = pOther->count;
+    uint32_t n = na + nb;
+    int64_t delta, x, q;
+    uint64_t delta2, w;
+
+    if (nb == 0) {
+        return;
+    }
+    if (na == 0) {
+        *S = *pOther;
+        return;
+    }
+
+    delta = (int64_t)pOther->mean - S->mean;
+
+    // n times the offset of the merged mean from meanA, rounded to the nearest multiple of n
+    x = delta * nb + S->meanRem + pOther->meanRem;
+    q = (x >= 0) ? (x + n / 2) / n : -((n / 2 - x) / n);
+
+    S->mean += (int32_t)q;
+    S->meanRem = (int32_t)(x - q * n);
+
+    // delta^2 * na * nb / n, split so that no intermediate product exceeds 64 bits
+    delta2 = (uint64_t)(delta * delta) >> S->fracBits;
+    w = (uint64_t)na * nb;
+    S->m2 += pOther->m2 + (int64_t)(delta2 * (w / n) + (delta2 / n) * (w % n) +
+                                    (delta2 % n) * (w % n) / n);
+    S->count = n;
+}
+
+/**
+  @} end of runningStats group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_merge_q32.c
+ * Description:  Merges two 32-bit fixed point running statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief         Merges two 32-bit fixed point running statistics.
+   @param[in,out] S          points to the running statistics to merge into
+   @param[in]     pOther     points to the running statistics of other samples
+   @return        none
+*/
+
+void plp_running_stats_merge_q32(plp_running_stats_instance_q32 *S,
+                                 const plp_running_stats_instance_q32 *pOther) {
+
+    uint32_t na = S->count;
+    uint32_t nb = pOther->count;
+    uint32_t n = na + nb;
+    int64_t delta, rem, r;
+    uint64_t absDelta, absRem, absX, q, delta2, w;
+    int32_t neg;
+
+    if (nb == 0) {
+        return;
+    }
+    if (na == 0) {
+        *S = *pOther;
+        return;
+    }
+
+    delta = (int64_t)pOther->mean - S->mean;
+
+    // full scale means differ by up to 2^32, square the magnitude as unsigned 64-bit value
+    absDelta = (delta < 0) ? (uint64_t)(-delta) : (uint64_t)delta;
+    delta2 = (absDelta * absDelta) >> S->fracBits;
+
+    // n times the offset of the merged mean from meanA is nb * delta plus both remainders. It
+    // needs up to 64 bits, so it is formed as unsigned magnitude and a sign.
+    rem = (int64_t)S->meanRem + pOther->meanRem;
+    absRem = (rem < 0) ? (uint64_t)(-rem) : (uint64_t)rem;
+    absX = absDelta * nb;
+    neg = (delta < 0);
+    if ((rem < 0) == neg) {
+        absX += absRem;
+    } else if (absX >= absRem) {
+        absX -= absRem;
+    } else {
+        absX = absRem - absX;
+        neg = !neg;
+    }
+
+    // round to the nearest multiple of n
+    q = absX / n;
+    r = (int64_t)(absX % n);
+    if (2 * r >= n) {
+        q++;
+        r -= n;
+    }
+
+    S->mean = (int32_t)(neg ? (int64_t)S->mean - (int64_t)q : (int64_t)S->mean + (int64_t)q);
+    S->meanRem = (int32_t)(neg ? -r : r);
+
+    // delta^2 * na * nb / n, split so that no intermediate product exceeds 64 bits
+    w = (uint64_t)na * nb;
+    S->m2 += pOther->m2 + (int64_t)(delta2 * (w / n) + (delta2 / n) * (w % n) +
+                                    (delta2 % n) * (w % n) / n);
+    S->count = n;
+}
+
+/**
+  @} end of runningStats group
+ */
@@ -0,0 +1,58 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_std_f32.c
+ * Description:  Standard deviation of the samples of the 32-bit float running statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief         Standard deviation of the samples of the 32-bit float running statistics.
+   @param[in]     S          points to an instance of the running statistics structure
+   @param[out]    pRes       standard deviation returned here
+   @return        none
+*/
+
+void plp_running_stats_std_f32(const plp_running_stats_instance_f32 *S,
+                               float32_t *__restrict__ pRes) {
+
+    float32_t var;
+
+    plp_running_stats_var_f32(S, &var);
+    plp_sqrt_f32(&var, pRes);
+}
+
+/**
+  @} end of runningStats group
+ */
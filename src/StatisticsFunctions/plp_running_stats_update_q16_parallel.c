@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_update_q16_parallel.c
+ * Description:  Parallel update of the 16-bit fixed point running statistics glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief         Glue code for the parallel update of the 16-bit fixed point running statistics.
+   @param[in,out] S          points to an instance of the running statistics structure
+   @param[in]     pSrc       points to the block of new samples
+   @param[in]     blockSize  number of new samples
+   @param[in]     nPE        number of parallel processing units
+   @return        none
+   @par Parallelization
+        Every core collects the statistics of a contiguous part of the block in its own partial
+   instance, which are then merged into S by core 0.
+*/
+
+void plp_running_stats_update_q16_parallel(plp_running_stats_instance_q16 *S,
+                                           const int16_t *__restrict__ pSrc,
+                                           uint32_t blockSize,
+                                           uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_running_stats_instance_q16 partial[nPE];
+        plp_running_stats_instance_q16_parallel P = { .S = S,
+                                                      .pSrc = pSrc,
+                                                      .blockSize = blockSize,
+                                                      .nPE = nPE,
+                                                      .pPartial = partial };
+
+        rt_team_fork(nPE, plp_running_stats_update_q16p_xpulpv2, (void *)&P);
+    }
+}
+
+/**
+  @} end of runningStats group
+ */
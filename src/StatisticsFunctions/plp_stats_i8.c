@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_i8.c
+ * Description:  Single pass statistics of a 8-bit integer vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup stats Stats
+   Gathers sum, sum of squares, minimum and maximum (with their first indices) of a vector in a
+   single pass over the data. Mean, variance, standard deviation and RMS value can then be derived
+   from the result with plp_stats_var_*, plp_stats_std_* and plp_stats_rms_* without touching the
+   data again, which saves the repeated passes of plp_var_*, plp_std_* and plp_min_* / plp_max_*
+   when several of these values are needed.
+
+   The sum of squares is accumulated in 64 bits, so it cannot overflow for 8- and 16-bit vectors
+   of any practical length. The integer variants (i8, i16) return the plain sum of squares. The
+   q16 variant shifts the exact sum right by fracBits once, the q32 variant shifts every square
+   by fracBits, as plp_power_q32 does. The integer results are returned in plp_stats_result_i32 and the derived
+   values use the same number of fractional bits (0 for integer vectors).
+*/
+
+/**
+   @addtogroup stats
+   @{
+*/
+
+/**
+   @brief         Glue code for single pass statistics of a 8-bit integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, must be at least one
+   @param[out]    pRes       statistics returned here
+   @return        none
+ */
+
+void plp_stats_i8(const int8_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  plp_stats_result_i32 *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_stats_i8s_rv32im(pSrc, blockSize, pRes);
+    } else {
+        plp_stats_i8s_xpulpv2(pSrc, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of stats group
+ */
@@ -0,0 +1,57 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_rms_f32.c
+ * Description:  Root mean square derived from single pass statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @addtogroup stats
+   @{
+*/
+
+/**
+   @brief         Root mean square derived from the statistics of a 32-bit float vector.
+   @param[in]     pStats     points to the statistics computed by plp_stats_*
+   @param[out]    pRes       root mean square returned here
+   @return        none
+ */
+
+void plp_stats_rms_f32(const plp_stats_result_f32 *__restrict__ pStats,
+                       float32_t *__restrict__ pRes) {
+
+    float32_t meanSq = pStats->sumSq / pStats->blockSize;
+
+    plp_sqrt_f32(&meanSq, pRes);
+}
+
+/**
+  @} end of stats group
+ */
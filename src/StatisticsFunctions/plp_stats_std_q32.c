@@ -0,0 +1,61 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stats_std_q32.c
+ * Description:  Standard deviation derived from single pass statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup stats
+*/
+
+/**
+   @addtogroup stats
+   @{
+*/
+
+/**
+   @brief         Standard deviation derived from the statistics of an integer or fixed point
+                  vector.
+   @param[in]     pStats     points to the statistics computed by plp_stats_*
+   @param[in]     fracBits   number of fractional bits of the statistics
+   @param[out]    pRes       standard deviation returned here
+   @return        none
+ */
+
+void plp_stats_std_q32(const plp_stats_result_i32 *__restrict__ pStats,
+                       uint32_t fracBits,
+                       int32_t *__restrict__ pRes) {
+
+    int32_t variance;
+
+    plp_stats_var_q32(pStats, fracBits, &variance);
+    plp_sqrt_q32(&variance, fracBits, pRes);
+}
+
+/**
+  @} end of stats group
+ */
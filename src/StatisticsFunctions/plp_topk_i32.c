@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_i32.c
+ * Description:  Top-k selection of a 32-bit integer vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup topk
+   @{
+*/
+
+/**
+   @brief         Glue code for top-k selection of a 32-bit integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, at least k
+   @param[in]     k          number of samples to select, 1 <= k <= PLP_TOPK_MAX
+   @param[out]    pVal       k largest values returned here in descending order
+   @param[out]    pIdx       their indices returned here
+   @return        none
+*/
+
+void plp_topk_i32(const int32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t k,
+                  int32_t *__restrict__ pVal,
+                  uint32_t *__restrict__ pIdx) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_topk_i32s_rv32im(pSrc, blockSize, k, pVal, pIdx);
+    } else {
+        plp_topk_i32s_xpulpv2(pSrc, blockSize, k, pVal, pIdx);
+    }
+}
+
+/**
+  @} end of topk group
+ */
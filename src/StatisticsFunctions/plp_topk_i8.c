@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_i8.c
+ * Description:  Top-k selection of a 8-bit integer vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup topk Top-k
+   Selects the k largest samples of a vector (k <= PLP_TOPK_MAX) together with their indices. The
+   current top k are kept sorted in a small local buffer and a new sample is only inserted if it
+   is larger than the k-th largest value so far, so most samples cost a single comparison. Equal
+   values keep the order of their indices.
+*/
+
+/**
+   @addtogroup topk
+   @{
+*/
+
+/**
+   @brief         Glue code for top-k selection of a 8-bit integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector, at least k
+   @param[in]     k          number of samples to select, 1 <= k <= PLP_TOPK_MAX
+   @param[out]    pVal       k largest values returned here in descending order
+   @param[out]    pIdx       their indices returned here
+   @return        none
+*/
+
+void plp_topk_i8(const int8_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t k,
+                 int8_t *__restrict__ pVal,
+                 uint32_t *__restrict__ pIdx) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_topk_i8s_rv32im(pSrc, blockSize, k, pVal, pIdx);
+    } else {
+        plp_topk_i8s_xpulpv2(pSrc, blockSize, k, pVal, pIdx);
+    }
+}
+
+/**
+  @} end of topk group
+ */
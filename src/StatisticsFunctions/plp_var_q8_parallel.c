@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var_q8_parallel.c
+ * Description:  Parallel variance of a 8-bit fixed point vector glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup var
+   @{
+*/
+
+/**
+   @brief         Glue code for parallel variance of a 8-bit fixed point vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   number of fractional bits
+   @param[in]     nPE        number of parallel processing units
+   @param[out]    pRes       variance returned here
+   @return        none
+   @par Parallelization
+        Mean and sum of squares are computed with plp_mean_i8_parallel and plp_power_q8_parallel.
+*/
+
+void plp_var_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        int8_t mean;
+        int32_t sumSq;
+
+        plp_mean_i8_parallel(pSrc, blockSize, nPE, &mean);
+        plp_power_q8_parallel(pSrc, blockSize, fracBits, nPE, &sumSq);
+
+        *pRes = sumSq / (int32_t)blockSize - ((mean * mean) >> fracBits);
+    }
+}
+
+/**
+  @} end of var group
+ */
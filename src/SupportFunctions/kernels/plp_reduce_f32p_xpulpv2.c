@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_reduce_f32p_xpulpv2.c
+ * Description:  Log-tree team reduction of 32-bit floating point partial results for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupSupport
+*/
+
+/**
+   @addtogroup Reduce
+   @{
+*/
+
+/**
+   @brief         Log-tree reduction of per-core 32-bit floating point partial results
+                  for XPULPV2 extension.
+   @param[in]     pBuf  points to nPE partial results, pBuf[rt_core_id()] of every core
+   @param[in]     nPE   number of cores of the team, all of them must call this function
+   @param[in]     op    PLP_REDUCE_SUM, PLP_REDUCE_MAX or PLP_REDUCE_MIN
+   @return        none, the result is returned in pBuf[0]
+*/
+
+void plp_reduce_f32p_xpulpv2(float32_t *pBuf,
+                             uint32_t nPE,
+                             uint32_t op) {
+
+    uint32_t core_id = rt_core_id();
+    uint32_t stride;
+    float32_t a, b;
+
+    for (stride = 1; stride < nPE; stride <<= 1) {
+        // partial results of the previous step have to be written
+        rt_team_barrier();
+
+        if ((core_id & ((stride << 1) - 1)) == 0 && core_id + stride < nPE) {
+            a = pBuf[core_id];
+            b = pBuf[core_id + stride];
+
+            switch (op) {
+            case PLP_REDUCE_MAX:
+                pBuf[core_id] = (b > a) ? b : a;
+                break;
+            case PLP_REDUCE_MIN:
+                pBuf[core_id] = (b < a) ? b : a;
+                break;
+            default:
+                pBuf[core_id] = a + b;
+                break;
+            }
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of Reduce group
+*/
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if fix_point is not None:
+        raise RuntimeError("FixPoint is not supported")
+    elif result_parameter.ctype == 'int8_t':
+        info = np.iinfo(np.int8)
+    elif result_parameter.ctype == 'int16_t':
+        info = np.iinfo(np.int16)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    a = inputs['pSrcA'].value.astype(np.int32)
+    b = inputs['pSrcB'].value.astype(np.int32)
+    result = np.clip(a + b, info.min, info.max)
+
+    return result
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    y = inputs['pSrcY'].value.astype(np.float64)
+    x = inputs['pSrcX'].value.astype(np.float64)
+    if inputs['pSrcY'].value.dtype == np.float32:
+        return np.arctan2(y, x).astype(np.float32)
+    # in turns, atan2(0, -x) is +0.5
+    scale = 2.0**fix_point
+    t = np.round(np.arctan2(y, x) / (2 * np.pi) * scale)
+    return np.clip(t, -scale, scale - 1).astype(inputs['pSrcY'].value.dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
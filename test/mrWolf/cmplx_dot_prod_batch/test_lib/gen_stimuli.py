@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['pSrcA'].value
+    b = inputs['pSrcB'].value
+    num_samples = env['num_samples']
+    if a.dtype == np.float32:
+        a = a.astype(np.float64).reshape(-1, num_samples, 2)
+        b = b.astype(np.float64).reshape(num_samples, 2)
+        a = a[:, :, 0] + 1j * a[:, :, 1]
+        y = a @ (b[:, 0] + 1j * b[:, 1])
+        return np.stack([y.real, y.imag], axis=1).flatten().astype(np.float32)
+    n_bits = 8 * a.dtype.itemsize
+    rnd = (1 << fix_point) >> 1
+    b = b.tolist()
+    # the q16 kernels clip an imaginary part of -32768 where they negate it
+    b_neg = [max(v, -32767) for v in b] if n_bits == 16 else b
+    res = []
+    for v in range(env['num_vectors']):
+        x = a[2 * num_samples * v:2 * num_samples * (v + 1)].tolist()
+        re = sum(x[2 * i] * b[2 * i] - x[2 * i + 1] * b_neg[2 * i + 1]
+                 for i in range(num_samples))
+        im = sum(x[2 * i] * b[2 * i + 1] + x[2 * i + 1] * b[2 * i] for i in range(num_samples))
+        res += [wrap(wrap(y + rnd, 2 * n_bits) >> fix_point, n_bits) for y in [re, im]]
+    return np.array(res, dtype=a.dtype)
+
+
+def wrap(x, n_bits):
+    return ((x + 2**(n_bits - 1)) % 2**n_bits) - 2**(n_bits - 1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
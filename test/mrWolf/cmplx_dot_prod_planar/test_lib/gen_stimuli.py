@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a, b, c, d = [inputs[n].value for n in ['pSrcARe', 'pSrcAIm', 'pSrcBRe', 'pSrcBIm']]
+    is_re = result_parameter.general_name() == 'realResult'
+    if a.dtype == np.float32:
+        a, b, c, d = [v.astype(np.float64) for v in [a, b, c, d]]
+        return np.array([np.sum(a * c - b * d if is_re else a * d + b * c)], dtype=np.float32)
+    n_bits = 8 * a.dtype.itemsize
+    a, b, c, d = [[int(v) for v in x] for x in [a, b, c, d]]
+    y = sum(a_ * c_ - b_ * d_ if is_re else a_ * d_ + b_ * c_ for a_, b_, c_, d_ in zip(a, b, c, d))
+    y = wrap(y + ((1 << fix_point) >> 1), 2 * n_bits)
+    return np.array([wrap(y >> fix_point, n_bits)], dtype=inputs['pSrcARe'].value.dtype)
+
+
+def wrap(x, n_bits):
+    return ((x + 2**(n_bits - 1)) % 2**n_bits) - 2**(n_bits - 1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
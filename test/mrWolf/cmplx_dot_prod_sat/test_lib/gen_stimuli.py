@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['pSrcA'].value.tolist()
+    b = inputs['pSrcB'].value.tolist()
+    n_bits = 8 * inputs['pSrcA'].value.dtype.itemsize
+    rnd = (1 << fix_point) >> 1
+    re = [a[i] * b[i] - a[i + 1] * b[i + 1] for i in range(0, len(a), 2)]
+    im = [a[i] * b[i + 1] + a[i + 1] * b[i] for i in range(0, len(a), 2)]
+    if n_bits == 16:
+        y = [(sum(re) + rnd) >> fix_point, (sum(im) + rnd) >> fix_point]
+    else:
+        y = [sum((x + rnd) >> fix_point for x in re), sum((x + rnd) >> fix_point for x in im)]
+    y = y[0] if 'realResult' in result_parameter.name else y[1]
+    hi = 2**(n_bits - 1) - 1
+    return np.array([min(max(y, -hi - 1), hi)], dtype=inputs['pSrcA'].value.dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
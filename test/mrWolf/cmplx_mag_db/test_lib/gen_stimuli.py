@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+
+import math
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    if x.dtype == np.float32:
+        x = x.astype(np.float64)
+        return (10 * np.log10(x[0::2]**2 + x[1::2]**2)).astype(np.float32)
+    info = np.iinfo(x.dtype)
+    # dB in Q8.8 for q16 and in Q16.16 for q32
+    out_frac = 8 if x.dtype == np.int16 else 16
+    res = []
+    for re, im in zip(x[0::2].tolist(), x[1::2].tolist()):
+        p = re * re + im * im
+        if p == 0:
+            res.append(info.min)
+            continue
+        db = 10 * (math.log10(p) - 2 * fix_point * math.log10(2))
+        res.append(min(max(round(db * 2**out_frac), info.min), info.max))
+    return np.array(res, dtype=x.dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['pSrcRe'].value
+    b = inputs['pSrcIm'].value
+    if a.dtype == np.float32:
+        return (a.astype(np.float64)**2 + b.astype(np.float64)**2).astype(np.float32)
+    # both squares summed at full precision and rounded once, the sum wraps in 32 bits for q16
+    n_bits = 8 * a.dtype.itemsize
+    rnd = (1 << fix_point) >> 1
+    result = []
+    for a_, b_ in zip([int(v) for v in a], [int(v) for v in b]):
+        y = a_ * a_ + b_ * b_ + rnd
+        if n_bits == 16:
+            y = wrap(y, 32)
+        result.append(wrap(y >> fix_point, n_bits))
+    return np.array(result, dtype=a.dtype)
+
+
+def wrap(x, n_bits):
+    return ((x + 2**(n_bits - 1)) % 2**n_bits) - 2**(n_bits - 1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['pSrcA'].value
+    b = inputs['pSrcB'].value
+    if a.dtype == np.float32:
+        y = (a[0::2] + 1j * a[1::2]).astype(np.complex128) * np.conj(b[0::2] + 1j * b[1::2])
+        return np.stack([y.real, y.imag], axis=1).flatten().astype(np.float32)
+    # both products summed at full precision and rounded once, the sum wraps in 32 bits for q16
+    a = [int(v) for v in a]
+    b = [int(v) for v in b]
+    n_bits = 8 * inputs['pSrcA'].value.dtype.itemsize
+    rnd = (1 << fix_point) >> 1
+    result = []
+    for i in range(0, len(a), 2):
+        re = a[i] * b[i] + a[i + 1] * b[i + 1]
+        im = a[i + 1] * b[i] - a[i] * neg_imag(b[i + 1], n_bits)
+        re, im = re + rnd, im + rnd
+        if n_bits == 16:
+            re, im = wrap(re, 32), wrap(im, 32)
+        result += [wrap(re >> fix_point, n_bits), wrap(im >> fix_point, n_bits)]
+    return np.array(result, dtype=inputs['pSrcA'].value.dtype)
+
+
+def neg_imag(x, n_bits):
+    """ imaginary part of pSrcB where the q16 kernels negate it, -32768 is clipped to -32767 """
+    return max(x, -32767) if n_bits == 16 else x
+
+
+def wrap(x, n_bits):
+    return ((x + 2**(n_bits - 1)) % 2**n_bits) - 2**(n_bits - 1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int32_t':
+        dtype = np.int32
+    elif result_parameter.ctype == 'float':
+        dtype = np.float32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    rows, cols, ker = env['rows'], env['cols'], env['ker']
+    # the samples between the end of a row and the start of the next one are not part of the image
+    x = inputs['pSrc'].value.astype(dtype).reshape(rows, env['stride'])[:, :cols]
+    k = inputs['pKernel'].value.astype(dtype).reshape(ker, ker)
+
+    # the full 2D convolution, 'same' takes the central part like scipy.signal.convolve2d
+    full = np.zeros((rows + ker - 1, cols + ker - 1), dtype=dtype)
+    for r in range(ker):
+        for c in range(ker):
+            full[r:r + rows, c:c + cols] += k[r, c] * x
+
+    if env['padding']:
+        off = (ker - 1) // 2
+        return full[off:off + rows, off:off + cols].flatten()
+    return full[ker - 1:rows, ker - 1:cols].flatten()
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
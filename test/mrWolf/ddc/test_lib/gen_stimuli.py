@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    taps, n, D = env['taps'], env['len'], env['decim']
+    line_len, dst_len = env['line_len'], env['dst_len']
+    coeffs = inputs['pCoeffs'].value.astype(np.float64) / 2**15
+    src = inputs['pSrc'].value.astype(np.float64).reshape(env['channels'], n, 2)
+    state = inputs['pState'].value.reshape(env['channels'], 2, line_len).astype(np.float64)
+    phase_inc = phase_incs[env['inc']]
+    name = result_parameter.general_name()
+
+    res = {'pState': [], 'pDst': [], 'pDstLen': []}
+    for ch in range(env['channels']):
+        # the phase wraps around, a full turn is 2^32
+        phase = phases(env)[ch] + np.arange(n, dtype=object) * phase_inc
+        theta = 2 * np.pi * (phase % 2**32).astype(np.float64) / 2**32
+        mixed = (src[ch, :, 0] + 1j * src[ch, :, 1]) * np.exp(1j * theta)
+        lines = [np.concatenate([state[ch, 0, :taps - 1], np.round(mixed.real)]),
+                 np.concatenate([state[ch, 1, :taps - 1], np.round(mixed.imag)])]
+        # the state keeps the last taps-1 samples of each line, the rest still holds the block
+        res['pState'] += [np.concatenate([line[n:], line[taps - 1:]])[:line_len] for line in lines]
+
+        dst = np.zeros((dst_len, 2))
+        out = range(index(env, ch), n, D)
+        for k, i in enumerate(out):
+            dst[k] = [np.dot(coeffs, line[i:i + taps]) for line in lines]
+        res['pDst'].append(np.clip(np.round(dst), -2**15, 2**15 - 1).flatten())
+        res['pDstLen'].append(len(out))
+
+    if name == 'pDstLen':
+        return np.array(res[name], dtype=np.int32)
+    return np.concatenate(res[name]).astype(np.int16)
+
+
+phase_incs = [0x00A3D70A, 0xF0000000]
+
+
+def phases(env):
+    return np.random.RandomState(env['len'] + env['taps']).randint(0, 2**32, env['channels'], dtype=np.int64)
+
+
+def index(env, ch):
+    return (env['start'] * (env['decim'] - 1) + ch) % env['decim']
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
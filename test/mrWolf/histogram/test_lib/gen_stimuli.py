@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['src'].value
+    n_bits = 8 * x.dtype.itemsize
+    # the signed samples are counted in offset binary, the unsigned ones as they are
+    if 'uint8_t' in inputs['pSrc'].value:
+        bins = x.view(np.uint8).astype(np.int64)
+    else:
+        bins = x.astype(np.int64) + (1 << (n_bits - 1))
+    bins >>= inputs['shift'].value
+    return np.bincount(bins, minlength=result_parameter.length).astype(np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
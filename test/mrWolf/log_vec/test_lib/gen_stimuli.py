@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    # the non-positive inputs give the smallest value
+    if x.dtype == np.float32:
+        y = np.log(np.maximum(x.astype(np.float64), np.finfo(np.float64).tiny))
+        return np.where(x > 0, y, np.finfo(np.float32).min).astype(np.float32)
+    info = np.iinfo(x.dtype)
+    scale = 2.0**fix_point
+    y = np.round(np.log(np.maximum(x.astype(np.float64), 1) / scale) * scale)
+    return np.where(x > 0, np.clip(y, info.min, info.max), info.min).astype(x.dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
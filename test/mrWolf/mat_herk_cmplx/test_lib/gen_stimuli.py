@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len_n']
+    x = inputs['pSrcX'].value
+    r = inputs['pDstR'].value
+    upper = np.triu(np.ones((N, N), dtype=bool))
+    if x.dtype == np.float32:
+        xc = to_complex(x, (N, ))
+        rc = to_complex(r, (N, N))
+        rc[upper] += np.outer(xc, xc.conj())[upper]
+        return to_interleaved(rc, np.float32)
+    n_bits = 8 * x.dtype.itemsize
+    x = x.reshape(N, 2).tolist()
+    res = r.reshape(N, N, 2).tolist()
+    for i in range(N):
+        for j in range(i, N):
+            re = term(x[i][0] * x[j][0] + x[i][1] * x[j][1], fix_point)
+            im = term(x[i][1] * x[j][0] - x[i][0] * x[j][1], fix_point)
+            res[i][j] = [wrap(res[i][j][0] + re, n_bits), wrap(res[i][j][1] + im, n_bits)]
+    return np.array(res, dtype=inputs['pSrcX'].value.dtype).flatten()
+
+
+def to_complex(x, shape):
+    x = x.astype(np.float64).reshape(shape + (2, ))
+    return x[..., 0] + 1j * x[..., 1]
+
+
+def to_interleaved(y, dtype):
+    return np.stack([y.real, y.imag], axis=-1).flatten().astype(dtype)
+
+
+def term(p, shift):
+    """ product rounded and shifted as in the kernels, then truncated to 32 bits """
+    return wrap((p + ((1 << shift) >> 1)) >> shift, 32)
+
+
+def wrap(x, n_bits):
+    return ((x + 2**(n_bits - 1)) % 2**n_bits) - 2**(n_bits - 1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N, O = env['len_m'], env['len_n'], env['len_o']
+    a = inputs['pSrcA'].value
+    b = inputs['pSrcB'].value
+    if a.dtype == np.float32:
+        return to_interleaved(to_complex(a, (N, M)).conj().T @ to_complex(b, (N, O)), np.float32)
+    n_bits = 8 * a.dtype.itemsize
+    a = a.reshape(N, M, 2).tolist()
+    b = b.reshape(N, O, 2).tolist()
+    res = []
+    for m in range(M):
+        for o in range(O):
+            re = sum(term(a[n][m][0] * b[n][o][0] + a[n][m][1] * b[n][o][1], fix_point)
+                     for n in range(N))
+            im = sum(term(a[n][m][0] * b[n][o][1] - a[n][m][1] * b[n][o][0], fix_point)
+                     for n in range(N))
+            res += [wrap(re, n_bits), wrap(im, n_bits)]
+    return np.array(res, dtype=inputs['pSrcA'].value.dtype)
+
+
+def to_complex(x, shape):
+    x = x.astype(np.float64).reshape(shape + (2, ))
+    return x[..., 0] + 1j * x[..., 1]
+
+
+def to_interleaved(y, dtype):
+    return np.stack([y.real, y.imag], axis=-1).flatten().astype(dtype)
+
+
+def term(p, shift):
+    """ product rounded and shifted as in the kernels, then truncated to 32 bits """
+    return wrap((p + ((1 << shift) >> 1)) >> shift, 32)
+
+
+def wrap(x, n_bits):
+    return ((x + 2**(n_bits - 1)) % 2**n_bits) - 2**(n_bits - 1)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    win, n = env['win'], env['len']
+    state = inputs['pState'].value.copy()
+    src = inputs['pSrc'].value
+    dst = np.zeros(len(src), dtype=src.dtype)
+
+    for c in range(len(src) // n):
+        window = state[c * win:(c + 1) * win]
+        index = env['index'][c]
+        for k in range(n):
+            # replace the oldest sample of the window by the new one
+            window[index] = src[c * n + k]
+            index = (index + 1) % win
+            # the output is the middle sample, the upper median for even window lengths
+            dst[c * n + k] = np.sort(window)[win // 2]
+
+    name = result_parameter.general_name()
+    if name == 'pState':
+        return state
+    if name == 'pSorted':
+        return np.concatenate([np.sort(state[c * win:(c + 1) * win]) for c in range(len(state) // win)])
+    return dst
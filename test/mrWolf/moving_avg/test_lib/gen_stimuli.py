@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    is_float = inputs['pSrc'].ctype == 'float'
+    dtype = inputs['pSrc'].value.dtype
+    win, n = env['win'], env['len']
+    state = inputs['pState'].value.copy()
+    src = inputs['pSrc'].value
+    dst = np.zeros(len(src), dtype=dtype)
+
+    for c in range(len(src) // n):
+        window = state[c * win:(c + 1) * win]
+        index = env['index'][c]
+        if is_float:
+            total = np.float32(0)
+            for v in window:
+                total += v
+            scale = np.float32(1) / np.float32(win)
+        else:
+            total = sum(int(v) for v in window)
+        for k in range(n):
+            x = src[c * n + k]
+            # replace the oldest sample of the window by the new one
+            if is_float:
+                total += x - window[index]
+                dst[c * n + k] = total * scale
+            else:
+                total += int(x) - int(window[index])
+                dst[c * n + k] = c_div(total, win)
+            window[index] = x
+            index = (index + 1) % win
+
+    if result_parameter.general_name() == 'pState':
+        return state
+    return dst
+
+
+def c_div(a, b):
+    """ integer division, rounding towards zero like C """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
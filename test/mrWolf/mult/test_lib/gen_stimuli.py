@@ -20,7 +20,10 @@ def compute_result(result_parameter, inputs, env, fix_point):
     fix_point: None (if no fixpoint is used) or decimal point
     """
     if fix_point is not None:
-        raise RuntimeError("FixPoint is not supported")
+        info = np.iinfo(result_parameter.ctype.replace('_t', ''))
+        a = inputs['pSrcA'].value.astype(np.int32)
+        b = inputs['pSrcB'].value.astype(np.int32)
+        result = np.clip((a * b + ((1 << fix_point) >> 1)) >> fix_point, info.min, info.max)
     elif result_parameter.ctype == 'int8_t':
         a = inputs['pSrcA'].value.astype(np.int8)
         b = inputs['pSrcB'].value.astype(np.int8)
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    phase, phase_inc = [int(w) for w in inputs['state'].value.view(np.uint32)]
+    n = inputs['blockSize'].value
+    if result_parameter.general_name() == 'state':
+        return np.array([(phase + n * phase_inc) % 2**32, phase_inc],
+                        dtype=np.uint32).astype(np.int32)
+
+    # the phase wraps around, a full turn is 2^32
+    theta = 2 * np.pi * ((phase + np.arange(n, dtype=object) * phase_inc) % 2**32).astype(np.float64) / 2**32
+    exp = np.empty(2 * n)
+    exp[0::2] = np.cos(theta)
+    exp[1::2] = np.sin(theta)
+    if result_parameter.ctype == 'float':
+        return exp.astype(np.float32)
+    scale = 2.0**fix_point
+    return np.clip(np.round(exp * scale), -scale, scale - 1).astype(result_parameter.get_dtype())
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
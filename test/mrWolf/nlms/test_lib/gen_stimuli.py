@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = inputs['pSrc'].ctype
+    is_float = ctype == 'float'
+    is_q16 = ctype == 'int16_t'
+    taps = env['taps']
+
+    if is_float:
+        dtype = np.float32
+        mu, gain = np.float32(env['mu'] / 2**15), np.float32(env['gain'] / 2**15)
+        rnd = lambda x: x
+        sq = lambda x: x * x
+        div = lambda a, energy: a / (energy + np.float32(1.19209290e-07))
+        st = list(inputs['pState'].value.astype(np.float32))
+        w = list(inputs['pCoeffs'].value.astype(np.float32))
+        src = list(inputs['pSrc'].value.astype(np.float32))
+        ref = list(inputs['pRef'].value.astype(np.float32))
+    else:
+        dtype = np.int16 if is_q16 else np.int32
+        mu, gain = env['mu'], env['gain']
+        rnd = lambda x: q_roundnorm(x, fix_point)
+        sq = lambda x: q_roundnorm(x * x, fix_point)
+        div = lambda a, energy: q_div(a, energy + 1)
+        st = [int(v) for v in inputs['pState'].value]
+        w = [int(v) for v in inputs['pCoeffs'].value]
+        src = [int(v) for v in inputs['pSrc'].value]
+        ref = [int(v) for v in inputs['pRef'].value]
+
+    energy = np.float32(0) if is_float else 0
+    for v in st[:taps]:
+        energy += sq(v)
+
+    # append the new block behind the history
+    st[taps:] = src
+    out = []
+    err = []
+    for n in range(env['len']):
+        # the update of the previous sample is fused with the output of the current one
+        acc = dtype(0) if is_float else 0
+        for k in range(taps):
+            w[k] = w[k] + rnd(gain * st[n + k])
+            if is_q16:
+                w[k] = wrap(w[k], 16)
+            acc = acc + rnd(w[k] * st[n + 1 + k])
+        if is_float:
+            e = ref[n] - acc
+        elif is_q16:
+            acc = q_clip(acc, 16)
+            e = q_clip(ref[n] - acc, 16)
+        else:
+            acc = wrap(acc, 32)
+            e = wrap(ref[n] - acc, 32)
+        out.append(acc)
+        err.append(e)
+        # slide the energy window: add the newest sample, drop the one that left the window
+        energy += sq(st[taps + n]) - sq(st[n])
+        gain = div(mu * e, energy)
+
+    name = result_parameter.general_name()
+    if name == 'pOut':
+        return np.array(out, dtype=dtype)
+    if name == 'pErr':
+        return np.array(err, dtype=dtype)
+    if name == 'pCoeffs':
+        return np.array(w, dtype=dtype)
+    if name == 'pState':
+        # the state keeps the last numTaps samples, the rest still holds the block
+        return np.array(st[env['len']:] + src, dtype=dtype)
+    raise RuntimeError("Unknown output: %s" % name)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def wrap(x, bits):
+    return ((x + 2**(bits - 1)) % 2**bits) - 2**(bits - 1)
+
+
+def q_clip(x, bits):
+    return max(-2**(bits - 1), min(2**(bits - 1) - 1, x))
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return (wrap(a, 32) + rounding) >> p
+
+
+def q_div(a, b):
+    """ integer division, rounding towards zero like C """
+    a = wrap(a, 32)
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
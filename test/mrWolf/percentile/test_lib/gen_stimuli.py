@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    hist = inputs['pHist'].value.astype(np.int64)
+    shift = inputs['shift'].value
+    # nearest rank, at least the first sample
+    rank = max((inputs['percent'].value * int(hist.sum()) + 99) // 100, 1)
+    b = min(int(np.argmax(np.cumsum(hist) >= rank)), len(hist) - 1)
+    center = (b << shift) + ((1 << shift) >> 1)
+    n_bits = 8 * np.dtype(result_parameter.get_dtype()).itemsize
+    # the signed bins are in offset binary, the unsigned ones wrap around in the int8 array
+    if 'uint8_t' not in inputs['pRes'].value:
+        center -= 1 << (n_bits - 1)
+    return np.array([center], dtype=np.int64).astype(result_parameter.get_dtype())
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -295,7 +295,7 @@ class ArrayArgument(Argument):
         dtype = self.get_dtype()
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
-        if self.value == GENERATE_STIMULI:
+        if isinstance(self.value, str) and self.value == GENERATE_STIMULI:
             self.value = call_dynamic_function(gen_stimuli, env, version, device, variable=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    is_float = inputs['pSrc'].ctype == 'float'
+    dtype = np.float32 if is_float else np.int64
+    h = inputs['pProto'].value.astype(dtype)
+    L, M, phase_len, n = env['up'], env['down'], env['phase_len'], env['len']
+    # the history of the previous block followed by the current block
+    x = np.concatenate([inputs['pState'].value[:phase_len - 1], inputs['pSrc'].value]).astype(dtype)
+
+    name = result_parameter.general_name()
+    if name == 'pState':
+        # the state keeps the last phaseLen-1 samples, the rest still holds the block
+        state = np.concatenate([x[n:], x[phase_len - 1:]])[:env['state_len']]
+        return state.astype(np.float32 if is_float else np.int16)
+    if name == 'pDstLen':
+        return np.array([env['out_len']], dtype=np.int32)
+
+    result = np.zeros(env['out_len'], dtype=np.float32 if is_float else np.int16)
+    for k in range(env['out_len']):
+        # position of the output on the upsampled grid, relative to the first sample of the block
+        t = env['phase'] + k * M
+        i, p = t // L, t % L
+        # taps of sub-filter p in the order of the dot product, oldest sample first
+        taps = [h[p + j * L] if p + j * L < env['taps'] else 0 for j in reversed(range(phase_len))]
+        window = x[i:i + phase_len]
+        if is_float:
+            acc = np.float32(0)
+            for a, b in zip(taps, window):
+                acc += np.float32(a) * b
+            result[k] = acc
+        else:
+            result[k] = np.clip(dot_prod_q16(taps, window, fix_point), -2**15, 2**15 - 1)
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def dot_prod_q16(a, b, p):
+    """ plp_dot_prod_q16 rounds and shifts the products in groups of 4 """
+    rounding = 1 << (p - 1)
+    groups = len(a) // 4
+    acc = 0
+    for g in range(groups):
+        acc += (sum(int(a[j]) * int(b[j]) for j in range(4 * g, 4 * g + 4)) + rounding) >> p
+    for j in range(4 * groups, len(a)):
+        acc += (int(a[j]) * int(b[j]) + rounding) >> p
+    return acc
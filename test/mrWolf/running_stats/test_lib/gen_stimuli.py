@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    state = [int(x) for x in inputs['state'].value.astype(np.int64)]
+    S = {'count': state[0], 'fracBits': state[1], 'mean': state[2], 'meanRem': state[3],
+         'm2': (state[5] << 32) | (state[4] & 0xFFFFFFFF)}
+    x = [int(v) for v in inputs['pSrc'].value.astype(np.int64)]
+    is_q32 = inputs['pSrc'].ctype == 'int32_t'
+    update = update_q32 if is_q32 else update_q16
+
+    if 'nPE' in inputs:
+        # every core collects the statistics of its chunk, which are then merged in core order
+        n_pe = inputs['nPE'].value
+        chunk = (len(x) + n_pe - 1) // n_pe
+        partials = []
+        for core_id in range(n_pe):
+            partial = {'count': 0, 'fracBits': S['fracBits'], 'mean': 0, 'meanRem': 0, 'm2': 0}
+            update(partial, x[core_id * chunk:(core_id + 1) * chunk], is_q32)
+            partials.append(partial)
+        for partial in partials:
+            merge(S, partial, is_q32)
+    else:
+        update(S, x, is_q32)
+
+    m2 = S['m2'] & 0xFFFFFFFFFFFFFFFF
+    result = np.array([S['count'], S['fracBits'], S['mean'] & 0xFFFFFFFF,
+                       S['meanRem'] & 0xFFFFFFFF, m2 & 0xFFFFFFFF, m2 >> 32], dtype=np.uint64)
+    return result.astype(np.uint32).astype(np.int32)
+
+
+#######################
+# Running Statistics  #
+#######################
+
+
+def round_div(a, b):
+    """ integer division of a by b > 0, rounding to the nearest value (halves away from zero) """
+    q = (abs(a) + b // 2) // b
+    return q if a >= 0 else -q
+
+
+def wrap32(x):
+    return ((x + 2**31) % 2**32) - 2**31
+
+
+def update_q32(S, x, is_q32):
+    """ two-pass block statistics, deviations squared with full precision """
+    if len(x) == 0:
+        return
+    mean = round_div(sum(x), len(x))
+    m2 = sum(((v - mean) ** 2) >> S['fracBits'] for v in x)
+    merge(S, {'count': len(x), 'fracBits': S['fracBits'], 'mean': mean,
+              'meanRem': sum(x) - mean * len(x), 'm2': m2}, is_q32)
+
+
+def update_q16(S, x, is_q32):
+    """ single-pass block statistics around the current mean (or the first sample) """
+    if len(x) == 0:
+        return
+    shift = S['mean'] if S['count'] > 0 else x[0]
+    d = [v - shift for v in x]
+    s1 = sum(d)
+    s2 = sum(v * v for v in d)
+    m = round_div(s1, len(x))
+    rem = s1 - m * len(x)
+    m2 = (s2 - 2 * m * s1 + len(x) * m * m - rem * rem // len(x)) >> S['fracBits']
+    merge(S, {'count': len(x), 'fracBits': S['fracBits'], 'mean': shift + m, 'meanRem': rem,
+              'm2': m2}, is_q32)
+
+
+def merge(S, other, is_q32):
+    na, nb = S['count'], other['count']
+    n = na + nb
+    if nb == 0:
+        return
+    if na == 0:
+        S.update(other)
+        return
+    delta = other['mean'] - S['mean']
+    delta2 = (delta * delta) >> S['fracBits']
+    # the merged mean is rounded, the remainder is carried along
+    x = delta * nb + S['meanRem'] + other['meanRem']
+    q = round_div(x, n)
+    S['mean'] = wrap32(S['mean'] + q)
+    S['meanRem'] = x - q * n
+    # delta^2 * na * nb / n, in the same parts as the C code
+    w = na * nb
+    S['m2'] += other['m2'] + delta2 * (w // n) + (delta2 // n) * (w % n) + \
+        (delta2 % n) * (w % n) // n
+    S['count'] = n
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    fun = np.sin if result_parameter.general_name() == 'pSin' else np.cos
+    if x.dtype == np.float32:
+        return fun(x.astype(np.float64)).astype(np.float32)
+    # Q1.x inputs map [-1, 1) to [-2*PI, 2*PI)
+    scale = 2.0**fix_point
+    y = np.round(fun(2 * np.pi * x.astype(np.float64) / scale) * scale)
+    return np.clip(y, -scale, scale - 1).astype(x.dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'float':
+        x = inputs['pSrc'].value.astype(np.float64)
+        return (np.sqrt(x)).astype(np.float32)
+
+    dtype = {'int32_t': np.int32, 'int16_t': np.int16, 'int8_t': np.int8}[result_parameter.ctype]
+    max_val = int(np.iinfo(dtype).max)
+    result = np.zeros(len(inputs['pSrc'].value), dtype=dtype)
+    for i, x in enumerate(inputs['pSrc'].value.astype(np.int64)):
+        # sqrt(x / 2^f) * 2^f, non-positive inputs give 0
+        if x > 0:
+            result[i] = min(int(np.round(np.sqrt(float(x) * 2.0**fix_point))), max_val)
+    return result
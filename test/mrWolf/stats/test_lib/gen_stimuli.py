@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    if x.dtype == np.float32:
+        # exact for the stimuli of the testset, whatever the order of the additions
+        sum_x = np.float32(np.sum(x.astype(np.float64)))
+        sum_sq = np.float32(np.sum(x.astype(np.float64) ** 2))
+        words = np.array([sum_x, sum_sq, x.min(), x.max()], dtype=np.float32).view(np.int32)
+        tail = [0, 0]
+    else:
+        v = [int(s) for s in x.astype(np.int64)]
+        shift = fix_point if fix_point is not None else 0
+        sum_x = wrap32(sum(v))
+        if x.dtype == np.int16 and fix_point is not None:
+            # q16 shifts the exact sum once
+            sum_sq = sum(s * s for s in v) >> shift
+        else:
+            sum_sq = sum((s * s) >> shift for s in v)
+        # padding, then the 64-bit sum of squares as low and high word
+        words = [sum_x, 0, wrap32(sum_sq), wrap32(sum_sq >> 32), min(v), max(v)]
+        tail = []
+    # np.argmin and np.argmax return the first occurrence
+    words = list(words) + [np.argmin(x), np.argmax(x), len(x)] + tail
+    return np.array(words, dtype=np.int64).astype(np.int32)
+
+
+##############
+# Statistics #
+##############
+
+
+def wrap32(x):
+    return ((x + 2**31) % 2**32) - 2**31